@@ -82,6 +82,7 @@ extern void (*my_str_free)(void *);
 /* Declared in int2str() */
 extern const char _dig_vec_upper[];
 extern const char _dig_vec_lower[];
+extern const char _dig_pairs[];
 
 extern char *strmov_overlapp(char *dest, const char *src);
 
@@ -901,12 +901,17 @@ extern char *strmake_root(MEM_ROOT *root,const char *str,size_t len);
 extern void *memdup_root(MEM_ROOT *root,const void *str, size_t len);
 extern my_bool my_compress(uchar *, size_t *, size_t *);
 extern my_bool my_uncompress(uchar *, size_t , size_t *);
+extern my_bool my_compress_packet(uchar *dest, const uchar *packet,
+                                  size_t *len, size_t *complen);
 extern uchar *my_compress_alloc(const uchar *packet, size_t *len,
                                 size_t *complen);
 extern void *my_az_allocator(void *dummy, unsigned int items, unsigned int size);
 extern void my_az_free(void *dummy, void *address);
 extern int my_compress_buffer(uchar *dest, size_t *destLen,
                               const uchar *source, size_t sourceLen);
+extern int my_compress_buffer_level(uchar *dest, size_t *destLen,
+                                    const uchar *source, size_t sourceLen,
+                                    int level);
 extern int packfrm(const uchar *, size_t, uchar **, size_t *);
 extern int unpackfrm(uchar **, size_t *, const uchar *);
 
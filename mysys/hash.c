@@ -31,6 +31,7 @@
 
 typedef struct st_hash_info {
   uint next;					/* index to next key */
+  my_hash_value_type hash_nr;			/* hash value of the key */
   uchar *data;					/* data for current entry */
 } HASH_LINK;
 
@@ -196,13 +197,10 @@ static uint my_hash_mask(my_hash_value_type hashnr, size_t buffmax,
   return (uint) (hashnr & ((buffmax >> 1) -1));
 }
 
-static uint my_hash_rec_mask(const HASH *hash, HASH_LINK *pos,
-                             size_t buffmax, size_t maxlength)
+static inline uint my_hash_rec_mask(HASH_LINK *pos,
+                                    size_t buffmax, size_t maxlength)
 {
-  size_t length;
-  uchar *key= (uchar*) my_hash_key(hash, pos->data, &length, 0);
-  return my_hash_mask(hash->hash_function(hash->charset, key, length), buffmax,
-                      maxlength);
+  return my_hash_mask(pos->hash_nr, buffmax, maxlength);
 }
 
 
@@ -286,7 +284,7 @@ uchar* my_hash_first_from_hash_value(const HASH *hash,
       if (flag)
       {
 	flag=0;					/* Reset flag */
-	if (my_hash_rec_mask(hash, pos, hash->blength, hash->records) != idx)
+	if (my_hash_rec_mask(pos, hash->blength, hash->records) != idx)
 	  break;				/* Wrong link */
       }
     }
@@ -379,14 +377,16 @@ my_bool my_hash_insert(HASH *info, const uchar *record)
 {
   int flag;
   size_t idx,halfbuff,first_index;
-  my_hash_value_type hash_nr;
+  my_hash_value_type hash_nr, rec_hash_nr;
+  my_hash_value_type UNINIT_VAR(hash_to_rec), UNINIT_VAR(hash_to_rec2);
   uchar *UNINIT_VAR(ptr_to_rec),*UNINIT_VAR(ptr_to_rec2);
   HASH_LINK *data,*empty,*UNINIT_VAR(gpos),*UNINIT_VAR(gpos2),*pos;
 
+  rec_hash_nr= rec_hashnr(info, record);
   if (info->flags & HASH_UNIQUE)
   {
     uchar *key= (uchar*) my_hash_key(info, record, &idx, 1);
-    if (my_hash_search(info, key, idx))
+    if (my_hash_search_using_hash_value(info, rec_hash_nr, key, idx))
       return(TRUE);				/* Duplicate entry */
   }
 
@@ -403,7 +403,7 @@ my_bool my_hash_insert(HASH *info, const uchar *record)
     do
     {
       pos=data+idx;
-      hash_nr=rec_hashnr(info,pos->data);
+      hash_nr=pos->hash_nr;
       if (flag == 0)				/* First loop; Check if ok */
 	if (my_hash_mask(hash_nr, info->blength, info->records) != first_index)
 	  break;
@@ -417,6 +417,7 @@ my_bool my_hash_insert(HASH *info, const uchar *record)
 	    /* key shall be moved to the current empty position */
 	    gpos=empty;
 	    ptr_to_rec=pos->data;
+	    hash_to_rec=hash_nr;
 	    empty=pos;				/* This place is now free */
 	  }
 	  else
@@ -424,6 +425,7 @@ my_bool my_hash_insert(HASH *info, const uchar *record)
 	    flag=LOWFIND | LOWUSED;		/* key isn't changed */
 	    gpos=pos;
 	    ptr_to_rec=pos->data;
+	    hash_to_rec=hash_nr;
 	  }
 	}
 	else
@@ -432,11 +434,13 @@ my_bool my_hash_insert(HASH *info, const uchar *record)
 	  {
 	    /* Change link of previous LOW-key */
 	    gpos->data=ptr_to_rec;
+	    gpos->hash_nr=hash_to_rec;
 	    gpos->next= (uint) (pos-data);
 	    flag= (flag & HIGHFIND) | (LOWFIND | LOWUSED);
 	  }
 	  gpos=pos;
 	  ptr_to_rec=pos->data;
+	  hash_to_rec=hash_nr;
 	}
       }
       else
@@ -447,6 +451,7 @@ my_bool my_hash_insert(HASH *info, const uchar *record)
 	  /* key shall be moved to the last (empty) position */
 	  gpos2 = empty; empty=pos;
 	  ptr_to_rec2=pos->data;
+	  hash_to_rec2=hash_nr;
 	}
 	else
 	{
@@ -454,11 +459,13 @@ my_bool my_hash_insert(HASH *info, const uchar *record)
 	  {
 	    /* Change link of previous hash-key and save */
 	    gpos2->data=ptr_to_rec2;
+	    gpos2->hash_nr=hash_to_rec2;
 	    gpos2->next=(uint) (pos-data);
 	    flag= (flag & LOWFIND) | (HIGHFIND | HIGHUSED);
 	  }
 	  gpos2=pos;
 	  ptr_to_rec2=pos->data;
+	  hash_to_rec2=hash_nr;
 	}
       }
     }
@@ -467,36 +474,41 @@ my_bool my_hash_insert(HASH *info, const uchar *record)
     if ((flag & (LOWFIND | LOWUSED)) == LOWFIND)
     {
       gpos->data=ptr_to_rec;
+      gpos->hash_nr=hash_to_rec;
       gpos->next=NO_RECORD;
     }
     if ((flag & (HIGHFIND | HIGHUSED)) == HIGHFIND)
     {
       gpos2->data=ptr_to_rec2;
+      gpos2->hash_nr=hash_to_rec2;
       gpos2->next=NO_RECORD;
     }
   }
   /* Check if we are at the empty position */
 
-  idx= my_hash_mask(rec_hashnr(info, record), info->blength, info->records + 1);
+  idx= my_hash_mask(rec_hash_nr, info->blength, info->records + 1);
   pos=data+idx;
   if (pos == empty)
   {
     pos->data=(uchar*) record;
+    pos->hash_nr= rec_hash_nr;
     pos->next=NO_RECORD;
   }
   else
   {
     /* Check if more records in same hash-nr family */
     empty[0]=pos[0];
-    gpos= data + my_hash_rec_mask(info, pos, info->blength, info->records + 1);
+    gpos= data + my_hash_rec_mask(pos, info->blength, info->records + 1);
     if (pos == gpos)
     {
       pos->data=(uchar*) record;
+      pos->hash_nr= rec_hash_nr;
       pos->next=(uint) (empty - data);
     }
     else
     {
       pos->data=(uchar*) record;
+      pos->hash_nr= rec_hash_nr;
       pos->next=NO_RECORD;
       movelink(data,(uint) (pos-data),(uint) (gpos-data),(uint) (empty-data));
     }
@@ -557,15 +569,14 @@ my_bool my_hash_delete(HASH *hash, uchar *record)
   else if (pos->next != NO_RECORD)
   {
     empty=data+(empty_index=pos->next);
-    pos->data=empty->data;
-    pos->next=empty->next;
+    pos[0]= empty[0];
   }
 
   if (empty == lastpos)			/* last key at wrong pos or no next link */
     goto exit;
 
   /* Move the last key (lastpos) */
-  lastpos_hashnr=rec_hashnr(hash,lastpos->data);
+  lastpos_hashnr= lastpos->hash_nr;
   /* pos is where lastpos should be */
   pos= data + my_hash_mask(lastpos_hashnr, hash->blength, hash->records);
   if (pos == empty)			/* Move to empty position. */
@@ -573,7 +584,7 @@ my_bool my_hash_delete(HASH *hash, uchar *record)
     empty[0]=lastpos[0];
     goto exit;
   }
-  pos_hashnr=rec_hashnr(hash,pos->data);
+  pos_hashnr= pos->hash_nr;
   /* pos3 is where the pos should be */
   pos3= data + my_hash_mask(pos_hashnr, hash->blength, hash->records);
   if (pos != pos3)
@@ -618,6 +629,7 @@ my_bool my_hash_update(HASH *hash, uchar *record, uchar *old_key,
 {
   uint new_index,new_pos_index,records;
   size_t idx, empty, blength;
+  my_hash_value_type new_hash_nr;
   HASH_LINK org_link,*data,*previous,*pos;
   DBUG_ENTER("my_hash_update");
   
@@ -645,9 +657,19 @@ my_bool my_hash_update(HASH *hash, uchar *record, uchar *old_key,
                                         (old_key_length ? old_key_length :
                                                           hash->key_length)),
                     blength, records);
-  new_index= my_hash_mask(rec_hashnr(hash, record), blength, records);
+  new_hash_nr= rec_hashnr(hash, record);
+  new_index= my_hash_mask(new_hash_nr, blength, records);
   if (idx == new_index)
-    DBUG_RETURN(0);			/* Nothing to do (No record check) */
+  {
+    /* The record stays in its chain; only remember its new hash value */
+    for (pos= data + idx; pos->data != record; pos= data + pos->next)
+    {
+      if (pos->next == NO_RECORD)
+        DBUG_RETURN(0);			/* Nothing to do (No record check) */
+    }
+    pos->hash_nr= new_hash_nr;
+    DBUG_RETURN(0);
+  }
   previous=0;
   for (;;)
   {
@@ -659,6 +681,7 @@ my_bool my_hash_update(HASH *hash, uchar *record, uchar *old_key,
       DBUG_RETURN(1);			/* Not found in links */
   }
   org_link= *pos;
+  org_link.hash_nr= new_hash_nr;
   empty=idx;
 
   /* Relink record from current chain */
@@ -695,7 +718,7 @@ my_bool my_hash_update(HASH *hash, uchar *record, uchar *old_key,
     DBUG_RETURN(0);
   }
   pos=data+new_index;
-  new_pos_index= my_hash_rec_mask(hash, pos, blength, records);
+  new_pos_index= my_hash_rec_mask(pos, blength, records);
   if (new_index != new_pos_index)
   {					/* Other record in wrong position */
     data[empty] = *pos;
@@ -781,7 +804,7 @@ my_bool my_hash_check(HASH *hash)
 
   for (i=found=max_links=seek=0 ; i < records ; i++)
   {
-    if (my_hash_rec_mask(hash, data + i, blength, records) == i)
+    if (my_hash_rec_mask(data + i, blength, records) == i)
     {
       found++; seek++; links=1;
       for (idx=data[i].next ;
@@ -797,8 +820,7 @@ my_bool my_hash_check(HASH *hash)
 	}
 	hash_info=data+idx;
 	seek+= ++links;
-	if ((rec_link= my_hash_rec_mask(hash, hash_info,
-                                        blength, records)) != i)
+	if ((rec_link= my_hash_rec_mask(hash_info, blength, records)) != i)
 	{
           DBUG_PRINT("error", ("Record in wrong link at %d: Start %d  "
                                "Record: 0x%lx  Record-link %d",
@@ -98,6 +98,14 @@ void my_az_free(void *dummy __attribute__((unused)), void *address)
 */
 int my_compress_buffer(uchar *dest, size_t *destLen,
                        const uchar *source, size_t sourceLen)
+{
+  return my_compress_buffer_level(dest, destLen, source, sourceLen,
+                                  Z_DEFAULT_COMPRESSION);
+}
+
+int my_compress_buffer_level(uchar *dest, size_t *destLen,
+                             const uchar *source, size_t sourceLen,
+                             int level)
 {
     z_stream stream;
     int err;
@@ -113,7 +121,7 @@ int my_compress_buffer(uchar *dest, size_t *destLen,
     stream.zfree = (free_func)my_az_free;
     stream.opaque = (voidpf)0;
 
-    err = deflateInit(&stream, Z_DEFAULT_COMPRESSION);
+    err = deflateInit(&stream, level);
     if (err != Z_OK) return err;
 
     err = deflate(&stream, Z_FINISH);
@@ -127,6 +135,57 @@ int my_compress_buffer(uchar *dest, size_t *destLen,
     return err;
 }
 
+/*
+   Compress a network packet into a separate buffer
+
+   SYNOPSIS
+     my_compress_packet()
+     dest	Where to store the result. Must have room for 'len' bytes.
+     packet	Data to compress. Not modified.
+     len	in:  Length of data to compress at 'packet'
+		out: Length of data stored at 'dest'
+     complen	out: 0 if packet was not compressed, otherwise the
+		     original length of the packet
+
+   NOTES
+     Unlike my_compress() this does not need a temporary buffer or an
+     extra copy of the data: deflate writes straight into 'dest', and
+     is only given room for a result shorter than the original, so a
+     packet that does not shrink is detected without compressing it
+     into a larger scratch buffer first. In that case the packet is
+     copied to 'dest' as is.
+
+     Packets are compressed with Z_BEST_SPEED, as the cost of deflate
+     is paid by the connection thread for every packet sent, while the
+     receiver can decompress data compressed at any level.
+
+   RETURN
+     0   ok. Something, compressed or not, is always stored at 'dest'
+*/
+
+my_bool my_compress_packet(uchar *dest, const uchar *packet,
+                           size_t *len, size_t *complen)
+{
+  DBUG_ENTER("my_compress_packet");
+  *complen= 0;
+  if (*len >= MIN_COMPRESS_LENGTH)
+  {
+    size_t destlen= *len - 1;
+    if (my_compress_buffer_level(dest, &destlen, packet, *len,
+                                 Z_BEST_SPEED) == Z_OK)
+    {
+      *complen= *len;
+      *len= destlen;
+      DBUG_RETURN(0);
+    }
+    DBUG_PRINT("note",("Packet did not shrink on compression; "
+                       "Not compressed"));
+  }
+  memcpy(dest, packet, *len);
+  DBUG_RETURN(0);
+}
+
+
 uchar *my_compress_alloc(const uchar *packet, size_t *len, size_t *complen)
 {
   uchar *compbuf;
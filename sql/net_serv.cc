@@ -628,10 +628,8 @@ net_real_write(NET *net,const uchar *packet, size_t len)
       net->reading_or_writing= 0;
       DBUG_RETURN(1);
     }
-    memcpy(b+header_length,packet,len);
-
-    if (my_compress(b+header_length, &len, &complen))
-      complen=0;
+    /* Compress straight from the caller's buffer, without a scratch copy */
+    my_compress_packet(b+header_length, packet, &len, &complen);
     int3store(&b[NET_HEADER_SIZE],complen);
     int3store(b,len);
     b[3]=(uchar) (net->compress_pkt_nr++);
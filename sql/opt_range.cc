@@ -393,6 +393,7 @@ static SEL_ARG *key_or(RANGE_OPT_PARAM *param,
 static SEL_ARG *key_and(RANGE_OPT_PARAM *param,
                         SEL_ARG *key1, SEL_ARG *key2,
                         uint clone_flag);
+static SEL_ARG *coarsen_key(RANGE_OPT_PARAM *param, SEL_ARG *key);
 static bool get_range(SEL_ARG **e1,SEL_ARG **e2,SEL_ARG *root1);
 bool get_quick_keys(PARAM *param,QUICK_RANGE_SELECT *quick,KEY_PART *key,
                     SEL_ARG *key_tree, uchar *min_key,uint min_key_flag,
@@ -2403,6 +2404,7 @@ int SQL_SELECT::test_quick_select(THD *thd, key_map keys_to_use,
   quick=0;
   needed_reg.clear_all();
   quick_keys.clear_all();
+  head->quick_coarsened_keys= 0;
   DBUG_ASSERT(!head->is_filled_at_execution());
   if (keys_to_use.is_clear_all() || head->is_filled_at_execution())
     DBUG_RETURN(0);
@@ -2508,6 +2510,7 @@ int SQL_SELECT::test_quick_select(THD *thd, key_map keys_to_use,
     }
     param.key_parts_end=key_parts;
     param.alloced_sel_args= 0;
+    param.start_budget();
 
     max_key_len++; /* Take into account the "+1" in QUICK_RANGE::QUICK_RANGE */
     if (!(param.min_key= (uchar*)alloc_root(&alloc,max_key_len)) ||
@@ -2557,8 +2560,12 @@ int SQL_SELECT::test_quick_select(THD *thd, key_map keys_to_use,
     /*
       Try to construct a QUICK_GROUP_MIN_MAX_SELECT.
       Notice that it can be constructed no matter if there is a range tree.
+      It takes the MIN/MAX values from the range tree, so it must not be
+      used if some of the ranges were coarsened.
     */
-    group_trp= get_best_group_min_max(&param, tree, best_read_time);
+    head->quick_coarsened_keys= param.n_coarsened_keys;
+    group_trp= param.n_coarsened_keys ? NULL :
+               get_best_group_min_max(&param, tree, best_read_time);
     if (group_trp)
     {
       param.table->quick_condition_rows= MY_MIN(group_trp->records,
@@ -3041,6 +3048,7 @@ bool calculate_cond_selectivity_for_table(THD *thd, TABLE *table, Item **cond)
     param.using_real_indexes= FALSE;
     param.real_keynr[0]= 0;
     param.alloced_sel_args= 0;
+    param.start_budget();
 
     thd->no_errors=1;		    
 
@@ -3467,6 +3475,7 @@ bool prune_partitions(THD *thd, TABLE *table, Item *pprune_cond)
   range_par->remove_jump_scans= FALSE;
   range_par->real_keynr[0]= 0;
   range_par->alloced_sel_args= 0;
+  range_par->start_budget();
 
   thd->no_errors=1;				// Don't warn about NULL
   thd->mem_root=&alloc;
@@ -8010,6 +8019,86 @@ sel_add(SEL_ARG *key1,SEL_ARG *key2)
 }
 
 
+/*
+  Check whether the range analysis has run out of its memory budget
+
+  DESCRIPTION
+    The memory is that of mem_root, which holds the range trees, and the
+    budget is @@range_optimizer_max_mem_size. The memory is only summed up
+    again when mem_root has allocated a new block since the last check.
+    Once the budget is exceeded it stays exceeded.
+
+  RETURN
+    TRUE   the budget is exceeded, new range trees should be coarsened
+    FALSE  otherwise
+*/
+
+bool RANGE_OPT_PARAM::budget_exceeded()
+{
+  DBUG_EXECUTE_IF("range_budget_exceeded", over_budget= TRUE;);
+  if (over_budget)
+    return TRUE;
+  ulonglong max_mem= thd->variables.range_optimizer_max_mem_size;
+  if (max_mem && mem_root->block_num != budget_mem_blocks)
+  {
+    size_t used= 0;
+    USED_MEM *block;
+    for (block= mem_root->free; block; block= block->next)
+      used+= block->size;
+    for (block= mem_root->used; block; block= block->next)
+      used+= block->size;
+    budget_mem_blocks= mem_root->block_num;
+    if (used > max_mem)
+      over_budget= TRUE;
+  }
+  return over_budget;
+}
+
+
+/*
+  Replace a SEL_ARG graph with one interval that covers all of its ranges
+
+  SYNOPSIS
+    coarsen_key()
+      param  Context info for the operation
+      key    Root of the SEL_ARG graph, one reference to it is consumed
+
+  DESCRIPTION
+    The new interval goes from the lowest to the highest endpoint of the
+    ranges on the first key part of the graph, the conditions on the
+    following key parts are dropped. It describes a superset of the rows of
+    the original graph, which is fine for range access as the table
+    condition is checked for every row read anyway. This is used to stop
+    the range trees from growing once the analysis is over its budget.
+
+  RETURN
+    The coarsened graph, or key itself if it cannot be made smaller
+*/
+
+static SEL_ARG *coarsen_key(RANGE_OPT_PARAM *param, SEL_ARG *key)
+{
+  if (!key || key->type != SEL_ARG::KEY_RANGE || key->simple_key())
+    return key;
+  SEL_ARG *first= key->first();
+  SEL_ARG *last= key->last();
+  if ((first->min_flag | last->max_flag) & GEOM_FLAG)
+    return key;
+
+  SEL_ARG *res= new (param->mem_root) SEL_ARG(first->field, first->part,
+                                              first->min_value,
+                                              last->max_value,
+                                              first->min_flag,
+                                              last->max_flag,
+                                              key->maybe_flag);
+  if (!res)
+    return key;                                 // OOM, keep the old graph
+  if (!--key->use_count)
+    key->free_tree();
+  param->n_coarsened_keys++;
+  return res;
+}
+
+
 /* 
   Build a range tree for the conjunction of the range parts of two trees
 
@@ -8079,6 +8168,8 @@ int and_range_trees(RANGE_OPT_PARAM *param, SEL_TREE *tree1, SEL_TREE *tree2,
 	result->type= SEL_TREE::IMPOSSIBLE;
         DBUG_RETURN(1);
       }
+      if (param->budget_exceeded())
+        result->keys[key_no]= key= coarsen_key(param, key);
       result_keys.set_bit(key_no);
 #ifdef EXTRA_DEBUG
       if (param->alloced_sel_args < SEL_ARG::MAX_SEL_ARGS) 
@@ -8571,7 +8662,11 @@ tree_or(RANGE_OPT_PARAM *param,SEL_TREE *tree1,SEL_TREE *tree2)
         key2->incr_refs();
       }
       if ((result->keys[key_no]= key_or(param, key1, key2)))
+      {
+        if (param->budget_exceeded())
+          result->keys[key_no]= coarsen_key(param, result->keys[key_no]);
         result->keys_map.set_bit(key_no);
+      }
     }
     result->type= tree1->type;
   }
@@ -649,6 +649,23 @@ class RANGE_OPT_PARAM
   /* Number of SEL_ARG objects allocated by SEL_ARG::clone_tree operations */
   uint alloced_sel_args;
 
+  /*
+    Memory budget of the range analysis, see budget_exceeded().
+    n_coarsened_keys is the number of SEL_ARG graphs that were replaced by
+    coarser ones because the budget ran out.
+  */
+  uint budget_mem_blocks;
+  bool over_budget;
+  uint n_coarsened_keys;
+
+  void start_budget()
+  {
+    budget_mem_blocks= 0;
+    over_budget= FALSE;
+    n_coarsened_keys= 0;
+  }
+  bool budget_exceeded();
+
   bool force_default_mrr;
   KEY_PART *key[MAX_KEY]; /* First key parts of keys used in the query */
 
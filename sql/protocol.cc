@@ -1056,15 +1056,43 @@ bool Protocol_text::store(const char *from, size_t length,
 }
 
 
+/**
+  Store an integer column value in decimal notation.
+
+  A number is at most 20 digits and a sign, so it always has a one byte
+  length prefix, and is converted in place at the end of the packet
+  instead of going through a temporary buffer and net_store_data().
+*/
+
+bool Protocol_text::store_numeric(longlong from, bool unsigned_flag)
+{
+#ifndef EMBEDDED_LIBRARY
+  /* Length byte, sign and digits, end NUL of longlong10_to_str() */
+  if (packet->reserve(1 + MY_INT64_NUM_DECIMAL_DIGITS + 1,
+                      PACKET_BUFFER_EXTRA_ALLOC))
+    return 1;
+  char *to= (char*) packet->ptr() + packet->length();
+  char *end= longlong10_to_str(from, to + 1, unsigned_flag ? 10 : -10);
+  *to= (char) (end - to - 1);
+  packet->length((uint32) (end - packet->ptr()));
+  return 0;
+#else
+  char buff[22];
+  return net_store_data((uchar*) buff,
+			(size_t) (longlong10_to_str(from, buff,
+                                                    unsigned_flag ? 10 : -10) -
+                                  buff));
+#endif
+}
+
+
 bool Protocol_text::store_tiny(longlong from)
 {
 #ifndef DBUG_OFF
   DBUG_ASSERT(field_types == 0 || field_types[field_pos] == MYSQL_TYPE_TINY);
   field_pos++;
 #endif
-  char buff[20];
-  return net_store_data((uchar*) buff,
-			(size_t) (int10_to_str((int) from, buff, -10) - buff));
+  return store_numeric(from, false);
 }
 
 
@@ -1076,10 +1104,7 @@ bool Protocol_text::store_short(longlong from)
 	      field_types[field_pos] == MYSQL_TYPE_SHORT);
   field_pos++;
 #endif
-  char buff[20];
-  return net_store_data((uchar*) buff,
-			(size_t) (int10_to_str((int) from, buff, -10) -
-                                  buff));
+  return store_numeric(from, false);
 }
 
 
@@ -1091,10 +1116,7 @@ bool Protocol_text::store_long(longlong from)
               field_types[field_pos] == MYSQL_TYPE_LONG);
   field_pos++;
 #endif
-  char buff[20];
-  return net_store_data((uchar*) buff,
-			(size_t) (int10_to_str((long int)from, buff,
-                                               (from <0)?-10:10)-buff));
+  return store_numeric(from, false);
 }
 
 
@@ -1105,11 +1127,7 @@ bool Protocol_text::store_longlong(longlong from, bool unsigned_flag)
 	      field_types[field_pos] == MYSQL_TYPE_LONGLONG);
   field_pos++;
 #endif
-  char buff[22];
-  return net_store_data((uchar*) buff,
-			(size_t) (longlong10_to_str(from,buff,
-                                                    unsigned_flag ? 10 : -10)-
-                                  buff));
+  return store_numeric(from, unsigned_flag);
 }
 
 
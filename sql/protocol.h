@@ -149,6 +149,7 @@ class Protocol
 
 class Protocol_text :public Protocol
 {
+  bool store_numeric(longlong from, bool unsigned_flag);
 public:
   Protocol_text(THD *thd_arg) :Protocol(thd_arg) {}
   virtual void prepare_for_resend();
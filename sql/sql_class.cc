@@ -4047,6 +4047,7 @@ void TMP_TABLE_PARAM::init()
   materialized_subquery= 0;
   force_not_null_cols= 0;
   skip_create_table= 0;
+  last_group_found= 0;
   DBUG_VOID_RETURN;
 }
 
@@ -540,6 +540,7 @@ typedef struct system_variables
   ulonglong sortbuff_size;
   ulonglong group_concat_max_len;
   ulonglong default_regex_flags;
+  ulonglong range_optimizer_max_mem_size;
 
   /**
      Place holders to store Multi-source variables in sys_var.cc during
@@ -749,6 +750,7 @@ typedef struct system_status_var
   ulong select_range_count_;
   ulong select_range_check_count_;
   ulong select_scan_count_;
+  ulong join_order_reuse_count;     /* +1 when a cached join order is used */
   ulong executed_triggers;
   ulong long_query_count;
   ulong filesort_merge_passes_;
@@ -4523,6 +4525,8 @@ class TMP_TABLE_PARAM :public Sql_alloc
   Copy_field *copy_field, *copy_field_end;
   Copy_field *save_copy_field, *save_copy_field_end;
   uchar	    *group_buff;
+  /* Group key of the last row end_update() found in a HEAP table */
+  uchar	    *last_group_buff;
   Item	    **items_to_copy;			/* Fields in tmp table */
   TMP_ENGINE_COLUMNDEF *recinfo, *start_recinfo;
   KEY *keyinfo;
@@ -4582,13 +4586,19 @@ class TMP_TABLE_PARAM :public Sql_alloc
     TRUE <=> create_tmp_table will create only the TABLE structure.
   */
   bool skip_create_table;
+  /*
+    TRUE <=> the HEAP table is positioned on the group in last_group_buff
+    and record[1] holds its current contents (see end_update()).
+  */
+  bool last_group_found;
 
   TMP_TABLE_PARAM()
-    :copy_field(0), group_parts(0),
+    :copy_field(0), last_group_buff(0), group_parts(0),
      group_length(0), group_null_parts(0),
     schema_table(0), materialized_subquery(0), force_not_null_cols(0),
     precomputed_group_by(0),
-    force_copy_fields(0), bit_fields_as_long(0), skip_create_table(0)
+    force_copy_fields(0), bit_fields_as_long(0), skip_create_table(0),
+    last_group_found(0)
   {}
   ~TMP_TABLE_PARAM()
   {
@@ -45,6 +45,10 @@ class Materialized_cursor: public Server_side_cursor
   ulong fetch_limit;
   ulong fetch_count;
   bool is_rnd_inited;
+  /* A row was read ahead by the previous fetch and is not sent yet */
+  bool row_pending;
+  /* The end of data was reported along with the rows of the last fetch */
+  bool last_row_sent;
 public:
   Materialized_cursor(select_result *result, TABLE *table);
 
@@ -233,7 +237,9 @@ Materialized_cursor::Materialized_cursor(select_result *result_arg,
   table(table_arg),
   fetch_limit(0),
   fetch_count(0),
-  is_rnd_inited(0)
+  is_rnd_inited(0),
+  row_pending(0),
+  last_row_sent(0)
 {
   fake_unit.init_query();
   fake_unit.thd= table->in_use;
@@ -336,9 +342,17 @@ int Materialized_cursor::open(JOIN *join __attribute__((unused)))
 
     If the cursor points after the last row, the fetch will automatically
     close the cursor and not send any data (except the 'EOF' packet
-    with SERVER_STATUS_LAST_ROW_SENT). This is an extra round trip
-    and probably should be improved to return
-    SERVER_STATUS_LAST_ROW_SENT along with the last row.
+    with SERVER_STATUS_LAST_ROW_SENT).
+
+    To save clients that extra round trip, one row is read ahead after
+    the requested rows are sent. If there is none, the 'EOF' packet
+    that ends the rows already has SERVER_STATUS_LAST_ROW_SENT, and the
+    client knows it need not fetch again. The cursor is still left open,
+    because stored procedure cursors detect the end of data by the cursor
+    being closed and close it with their next fetch as above;
+    mysqld_stmt_fetch() closes it right away instead.
+    Otherwise the row stays in the record buffer and is the first one
+    sent by the next fetch.
 */
 
 void Materialized_cursor::fetch(ulong num_rows)
@@ -347,22 +361,42 @@ void Materialized_cursor::fetch(ulong num_rows)
 
   int res= 0;
   result->begin_dataset();
-  for (fetch_limit+= num_rows; fetch_count < fetch_limit; fetch_count++)
+  if (last_row_sent)
+    res= HA_ERR_END_OF_FILE;
+  else
   {
-    if ((res= table->file->ha_rnd_next(table->record[0])))
-      break;
-    /* Send data only if the read was successful. */
-    /*
-      If network write failed (i.e. due to a closed socked),
-      the error has already been set. Just return.
-    */
-    if (result->send_data(item_list) > 0)
-      return;
+    for (fetch_limit+= num_rows; fetch_count < fetch_limit; fetch_count++)
+    {
+      if (row_pending)
+        row_pending= false;
+      else if ((res= table->file->ha_rnd_next(table->record[0])))
+        break;
+      /* Send data only if the read was successful. */
+      /*
+        If network write failed (i.e. due to a closed socked),
+        the error has already been set. Just return.
+      */
+      if (result->send_data(item_list) > 0)
+        return;
+    }
+
+    if (!res && num_rows && !row_pending)
+    {
+      if (!(res= table->file->ha_rnd_next(table->record[0])))
+        row_pending= true;
+      else if (res == HA_ERR_END_OF_FILE)
+      {
+        last_row_sent= true;
+        res= 0;
+      }
+    }
   }
 
   switch (res) {
   case 0:
     thd->server_status|= SERVER_STATUS_CURSOR_EXISTS;
+    if (last_row_sent)
+      thd->server_status|= SERVER_STATUS_LAST_ROW_SENT;
     result->send_eof();
     break;
   case HA_ERR_END_OF_FILE:
@@ -850,6 +850,8 @@ void Explain_select::print_explain_json(Explain_query *query,
   {
     writer->add_member("query_block").start_object();
     writer->add_member("select_id").add_ll(select_id);
+    if (pruned_partial_plans)
+      writer->add_member("pruned_partial_plans").add_ll(pruned_partial_plans);
 
     if (is_analyze && time_tracker.get_loops())
     {
@@ -1585,6 +1587,9 @@ void Explain_table_access::print_explain_json(Explain_query *query,
     quick_info->print_json(writer);
     writer->end_object();
   }
+
+  if (coarsened_ranges)
+    writer->add_member("coarsened_ranges").add_ll(coarsened_ranges);
   
   /* `ref` */
   if (!ref_list.is_empty())
@@ -211,6 +211,7 @@ class Explain_select : public Explain_basic_join
     message(NULL),
     having(NULL), having_value(Item::COND_UNDEF),
     using_temporary(false), using_filesort(false),
+    pruned_partial_plans(0),
     time_tracker(is_analyze),
     ops_tracker(is_analyze)
   {}
@@ -241,6 +242,9 @@ class Explain_select : public Explain_basic_join
   bool using_temporary;
   bool using_filesort;
 
+  /* Partial plans not expanded by the join order search, JSON only */
+  uint pruned_partial_plans;
+
   /* ANALYZE members */
   Time_and_counter_tracker time_tracker;
 
@@ -610,6 +614,7 @@ class Explain_table_access : public Sql_alloc
     non_merged_sjm_number(0),
     extra_tags(root),
     range_checked_fer(NULL),
+    coarsened_ranges(0),
     full_scan_on_null_key(false),
     start_dups_weedout(false),
     end_dups_weedout(false),
@@ -684,6 +689,9 @@ class Explain_table_access : public Sql_alloc
   
   /* Non-NULL value means this tab uses "range checked for each record" */
   Explain_range_checked_fer *range_checked_fer;
+
+  /* Number of range trees coarsened by the range optimizer, see coarsen_key() */
+  uint coarsened_ranges;
  
   bool full_scan_on_null_key;
 
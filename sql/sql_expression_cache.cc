@@ -44,7 +44,7 @@ Expression_cache_tmptable::Expression_cache_tmptable(THD *thd,
                                                      List<Item> &dependants,
                                                      Item *value)
   :cache_table(NULL), table_thd(thd), tracker(NULL), items(dependants), val(value),
-   hit(0), miss(0), inited (0)
+   hit(0), miss(0), flush_hit(0), flush_miss(0), inited (0)
 {
   DBUG_ENTER("Expression_cache_tmptable::Expression_cache_tmptable");
   DBUG_VOID_RETURN;
@@ -222,8 +222,10 @@ Expression_cache::result Expression_cache_tmptable::check_value(Item **value)
 
     if (res)
     {
-      if (((++miss) == EXPCACHE_CHECK_HIT_RATIO_AFTER) &&
-          ((double)hit / ((double)hit + miss)) <
+      /* Same window as in put_value(): since the table was last emptied */
+      ulong last_hit= hit - flush_hit, last_miss= (++miss) - flush_miss;
+      if (last_miss == EXPCACHE_CHECK_HIT_RATIO_AFTER &&
+          ((double)last_hit / ((double)last_hit + last_miss)) <
           EXPCACHE_MIN_HIT_RATE_FOR_MEM_TABLE)
       {
         DBUG_PRINT("info",
@@ -275,12 +277,20 @@ my_bool Expression_cache_tmptable::put_value(Item *value)
   if ((error= cache_table->file->ha_write_tmp_row(cache_table->record[0])))
   {
     /* create_myisam_from_heap will generate error if needed */
-    if (cache_table->file->is_fatal_error(error, HA_CHECK_DUP))
+    if (error != HA_ERR_RECORD_FILE_FULL &&
+        cache_table->file->is_fatal_error(error, HA_CHECK_DUP))
       goto err;
     else
     {
-      double hit_rate= ((double)hit / ((double)hit + miss));
-      DBUG_ASSERT(miss > 0);
+      /*
+        Judge the cache by the probes since the table was emptied the last
+        time: reuse of subquery parameters often comes in phases, and an
+        early phase should neither keep a useless cache nor switch off a
+        useful one.
+      */
+      ulong last_hit= hit - flush_hit, last_miss= miss - flush_miss;
+      double hit_rate= ((double)last_hit / ((double)last_hit + last_miss));
+      DBUG_ASSERT(last_miss > 0);
       if (hit_rate < EXPCACHE_MIN_HIT_RATE_FOR_MEM_TABLE)
       {
         DBUG_PRINT("info", ("hit rate is not so good to keep the cache"));
@@ -293,6 +303,8 @@ my_bool Expression_cache_tmptable::put_value(Item *value)
         if (cache_table->file->ha_delete_all_rows() ||
             cache_table->file->ha_write_tmp_row(cache_table->record[0]))
           goto err;
+        flush_hit= hit;
+        flush_miss= miss;
       }
       else
       {
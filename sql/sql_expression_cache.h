@@ -152,6 +152,8 @@ class Expression_cache_tmptable :public Expression_cache
   Item *val;
   /* hit/miss counters */
   ulong hit, miss;
+  /* hit/miss counters when the cache table was emptied the last time */
+  ulong flush_hit, flush_miss;
   /* Set on if the object has been succesfully initialized with init() */
   bool inited;
 };
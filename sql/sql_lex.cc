@@ -2090,6 +2090,7 @@ void st_select_lex::init_query()
   leaf_tables.empty();
   item_list.empty();
   join= 0;
+  join_order_cache= 0;
   having= prep_having= where= prep_where= 0;
   olap= UNSPECIFIED_OLAP_TYPE;
   having_fix_field= 0;
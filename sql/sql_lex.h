@@ -566,6 +566,7 @@ typedef class st_select_lex_node SELECT_LEX_NODE;
 class THD;
 class select_result;
 class JOIN;
+class Join_order_cache;
 class select_union;
 class Procedure;
 class Explain_query;
@@ -752,6 +753,12 @@ class st_select_lex: public st_select_lex_node
   List<Item_func_match> *ftfunc_list;
   List<Item_func_match> ftfunc_list_alloc;
   JOIN *join; /* after JOIN::prepare it is pointer to corresponding JOIN */
+  /*
+    Join order of the last full optimization of this select, reused by the
+    later executions of a prepared statement or stored routine. Allocated
+    on the statement arena, see choose_plan().
+  */
+  Join_order_cache *join_order_cache;
   List<TABLE_LIST> top_join_list; /* join list of the top level          */
   List<TABLE_LIST> *join_list;    /* list for the currently parsed join  */
   TABLE_LIST *embedding;          /* table embedding to the above list   */
@@ -3078,7 +3078,13 @@ void mysqld_stmt_fetch(THD *thd, char *packet, uint packet_length)
 
   cursor->fetch(num_rows);
 
-  if (!cursor->is_open())
+  /*
+    The client does not fetch again once it has seen
+    SERVER_STATUS_LAST_ROW_SENT, so close a cursor that read ahead past
+    its last row now rather than on a fetch that never comes.
+  */
+  if (!cursor->is_open() ||
+      (thd->server_status & SERVER_STATUS_LAST_ROW_SENT))
   {
     stmt->close_cursor();
     reset_stmt_params(stmt);
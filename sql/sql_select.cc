@@ -103,12 +103,14 @@ static void optimize_straight_join(JOIN *join, table_map join_tables);
 static bool greedy_search(JOIN *join, table_map remaining_tables,
                           uint depth, uint prune_level,
                           uint use_cond_selectivity);
+class Join_prefix_memo;
 static bool best_extension_by_limited_search(JOIN *join,
                                              table_map remaining_tables,
                                              uint idx, double record_count,
                                              double read_time, uint depth,
                                              uint prune_level,
-                                             uint use_cond_selectivity);
+                                             uint use_cond_selectivity,
+                                             Join_prefix_memo *memo);
 static uint determine_search_depth(JOIN* join);
 C_MODE_START
 static int join_tab_cmp(const void *dummy, const void* ptr1, const void* ptr2);
@@ -6589,6 +6591,185 @@ static void choose_initial_table_order(JOIN *join)
 }
 
 
+/*
+  A cached join order may be reused while its cost and the number of rows
+  in each of its tables stay within this factor of what they were when the
+  order was chosen.
+*/
+#define JOIN_ORDER_CACHE_MAX_DRIFT 2.0
+
+/**
+  Join order chosen by a full optimization of a select, see choose_plan()
+*/
+
+class Join_order_cache : public Sql_alloc
+{
+public:
+  uint table_count;         /* Number of tables in the arrays below */
+  uint max_tables;          /* Number of tables the arrays can hold */
+  TABLE_LIST **tables;      /* Non-constant tables in join order */
+  ha_rows *records;         /* stat_records() of each of the tables */
+  double read_time;         /* Cost of the join order */
+  /* Settings that the join order depends on */
+  ulonglong optimizer_switch;
+  uint join_cache_level;
+  uint use_cond_selectivity;
+};
+
+
+/**
+  Check whether the join order of a join can be cached for the next
+  executions of its select
+
+  @note
+    Only selects of prepared statements and stored routines are executed
+    more than once. Semi-join nests are left out, as their join order is
+    tied to the semi-join strategy that was chosen with it.
+*/
+
+static bool join_order_cache_usable(JOIN *join)
+{
+  return !join->thd->stmt_arena->is_conventional() &&
+         !join->emb_sjm_nest &&
+         join->select_lex->sj_nests.is_empty() &&
+         join->table_count - join->const_tables > 1;
+}
+
+
+/**
+  Try to reuse the join order that an earlier execution of the select chose
+
+  @details
+    The cached order is used if the current non-constant tables are the
+    same as when it was chosen, the optimizer settings are unchanged and
+    the number of rows in no table has drifted too far. The order is then
+    costed again with optimize_straight_join(), which runs
+    best_access_path() once per table, so the access methods follow the
+    current parameter values. If the new cost has grown too much compared
+    to the cached one, the order is given up and the caller does a full
+    search.
+
+  @retval TRUE   The cached order is in join->best_positions
+  @retval FALSE  A full search has to be done
+*/
+
+static bool reuse_join_order(JOIN *join, table_map join_tables)
+{
+  THD *thd= join->thd;
+  Join_order_cache *cache= join->select_lex->join_order_cache;
+  uint n_tables= join->table_count - join->const_tables;
+  JOIN_TAB **best_ref= join->best_ref + join->const_tables;
+  JOIN_TAB *saved_ref[MAX_TABLES];
+  table_map remaining_tables= join_tables;
+  bool reused= FALSE, drifted= FALSE;
+  uint i;
+  DBUG_ENTER("reuse_join_order");
+
+  if (!cache || !join_order_cache_usable(join) ||
+      cache->table_count != n_tables ||
+      cache->optimizer_switch != thd->variables.optimizer_switch ||
+      cache->join_cache_level != thd->variables.join_cache_level ||
+      cache->use_cond_selectivity !=
+        thd->variables.optimizer_use_condition_selectivity)
+    DBUG_RETURN(FALSE);
+
+  memcpy(saved_ref, best_ref, sizeof(JOIN_TAB*) * n_tables);
+  for (i= 0; i < n_tables; i++)
+  {
+    JOIN_TAB *s= NULL;
+    for (uint j= 0; j < n_tables; j++)
+    {
+      if (saved_ref[j]->table->pos_in_table_list == cache->tables[i])
+      {
+        s= saved_ref[j];
+        break;
+      }
+    }
+    /* The tables must be the same and still make a valid join order */
+    if (!s || (remaining_tables & s->dependent) ||
+        (join->const_tables + i && check_interleaving_with_nj(s)))
+      break;
+    best_ref[i]= s;
+    remaining_tables&= ~s->table->map;
+
+    double records= (double) s->table->stat_records() + 1;
+    double cached_records= (double) cache->records[i] + 1;
+    if (records > cached_records * JOIN_ORDER_CACHE_MAX_DRIFT ||
+        cached_records > records * JOIN_ORDER_CACHE_MAX_DRIFT)
+    {
+      /* best_ref[i] is set, so count it for restoring the nj state below */
+      drifted= TRUE;
+      i++;
+      break;
+    }
+  }
+
+  if (i == n_tables && !drifted)
+  {
+    optimize_straight_join(join, join_tables);
+    if ((reused= join->best_read <=
+                 cache->read_time * JOIN_ORDER_CACHE_MAX_DRIFT))
+      status_var_increment(thd->status_var.join_order_reuse_count);
+  }
+
+  /* Leave the nested join state as it was for the search */
+  while (i--)
+    restore_prev_nj_state(best_ref[i]);
+  if (!reused)
+    memcpy(best_ref, saved_ref, sizeof(JOIN_TAB*) * n_tables);
+  DBUG_RETURN(reused);
+}
+
+
+/**
+  Remember the join order in join->best_positions for the next executions
+  of the select
+*/
+
+static void save_join_order(JOIN *join)
+{
+  THD *thd= join->thd;
+  Join_order_cache *cache= join->select_lex->join_order_cache;
+  uint n_tables= join->table_count - join->const_tables;
+  POSITION *pos= join->best_positions + join->const_tables;
+
+  if (!join_order_cache_usable(join))
+    return;
+
+  if (!cache || cache->max_tables < n_tables)
+  {
+    MEM_ROOT *mem_root= thd->stmt_arena->mem_root;
+    if (!(cache= new (mem_root) Join_order_cache) ||
+        !(cache->tables= (TABLE_LIST**) alloc_root(mem_root,
+                                                   sizeof(TABLE_LIST*) *
+                                                   n_tables)) ||
+        !(cache->records= (ha_rows*) alloc_root(mem_root,
+                                                sizeof(ha_rows) * n_tables)))
+    {
+      join->select_lex->join_order_cache= NULL;
+      return;
+    }
+    cache->max_tables= n_tables;
+    join->select_lex->join_order_cache= cache;
+  }
+
+  cache->table_count= 0;
+  for (uint i= 0; i < n_tables; i++)
+  {
+    TABLE *table= pos[i].table->table;
+    if (!(cache->tables[i]= table->pos_in_table_list))
+      return;                                   // Can't be found again
+    cache->records[i]= table->stat_records();
+  }
+  cache->table_count= n_tables;
+  cache->read_time= join->best_read;
+  cache->optimizer_switch= thd->variables.optimizer_switch;
+  cache->join_cache_level= thd->variables.join_cache_level;
+  cache->use_cond_selectivity=
+    thd->variables.optimizer_use_condition_selectivity;
+}
+
+
 /**
   Selects and invokes a search strategy for an optimal query plan.
 
@@ -6601,6 +6782,8 @@ static void choose_initial_table_order(JOIN *join)
   @param join         pointer to the structure providing all context info for
                       the query
   @param join_tables  set of the tables in the query
+  @param use_order_cache  reuse and remember the join order of earlier
+                      executions of the select, see reuse_join_order()
 
   @todo
     'MAX_TABLES+2' denotes the old implementation of find_best before
@@ -6613,7 +6796,7 @@ static void choose_initial_table_order(JOIN *join)
 */
 
 bool
-choose_plan(JOIN *join, table_map join_tables)
+choose_plan(JOIN *join, table_map join_tables, bool use_order_cache)
 {
   uint search_depth= join->thd->variables.optimizer_search_depth;
   uint prune_level=  join->thd->variables.optimizer_prune_level;
@@ -6666,7 +6849,7 @@ choose_plan(JOIN *join, table_map join_tables)
   {
     optimize_straight_join(join, join_tables);
   }
-  else
+  else if (!use_order_cache || !reuse_join_order(join, join_tables))
   {
     if (search_depth == MAX_TABLES+2)
     { /*
@@ -6689,6 +6872,8 @@ choose_plan(JOIN *join, table_map join_tables)
                         use_cond_selectivity))
         DBUG_RETURN(TRUE);
     }
+    if (use_order_cache)
+      save_join_order(join);
   }
 
   /* 
@@ -6996,6 +7181,141 @@ optimize_straight_join(JOIN *join, table_map join_tables)
 }
 
 
+/*
+  The join order search memoizes partial plans when it has at least this
+  many tables to order. Smaller searches are cheap enough without it.
+*/
+#define JOIN_PREFIX_MEMO_MIN_TABLES 6
+/* Maximum size of the memo, a power of 2 */
+#define JOIN_PREFIX_MEMO_MAX_SIZE 65536
+
+/**
+  Memo of the cheapest partial plan found for each set of tables
+
+  @details
+    A depth-first join order search reaches the same set of tables through
+    many different orders. A partial plan is not expanded if an earlier one
+    with the same tables is not more expensive and produces no more rows.
+
+    This is a heuristic, like optimizer_prune_level=1. The cost of
+    completing a partial plan mostly depends on the set of tables in it and
+    on the number of rows it produces, but not only: prev_record_reads()
+    looks at the order of the tables in the partial plan to estimate how
+    often a ref access is repeated. So the memo can skip the best plan. It
+    is only used with optimizer_prune_level=1 and the optimizer_switch flag
+    join_prefix_memo, so that optimizer_prune_level=0 is still an
+    exhaustive search.
+
+    The memo is a fixed size hash table with open addressing, keyed by the
+    bitmap of the tables. When it is full, new sets are not added, but the
+    memoized ones are still used. Each step of greedy_search() starts with
+    an empty memo; reset() only starts a new generation of entries, so it
+    does not depend on the size of the memo.
+*/
+
+class Join_prefix_memo : public Sql_alloc
+{
+  struct Entry
+  {
+    table_map tables;           /* 0 means a free entry */
+    double record_count;
+    double read_time;
+    /* TRUE <=> join->sort_by_table is the first table of the plan */
+    bool sort_table_first;
+    /* The entry is free unless this is the generation of the memo */
+    uint generation;
+  };
+  Entry *entries;
+  uint size_mask;
+  uint free_entries;
+  uint generation;
+
+public:
+  /* Number of partial plans that were not expanded */
+  uint pruned_plans;
+
+  bool init(MEM_ROOT *mem_root, uint n_tables, uint search_depth)
+  {
+    /*
+      A step of the search memoizes the sets of the remaining tables left
+      after adding 1 to search_depth-1 tables to the plan. Have room for a
+      third more entries than there are such sets.
+    */
+    ulonglong n_sets= 0, n_subsets= 1;
+    for (uint k= 1; k < search_depth && k <= n_tables &&
+                    n_sets < JOIN_PREFIX_MEMO_MAX_SIZE; k++)
+    {
+      n_subsets= n_subsets * (n_tables - k + 1) / k;
+      n_sets+= n_subsets;
+    }
+    uint size= 64;
+    while (size < JOIN_PREFIX_MEMO_MAX_SIZE && size / 4 * 3 < n_sets)
+      size*= 2;
+    size_mask= size - 1;
+    if (!(entries= (Entry*) alloc_root(mem_root, sizeof(Entry) * size)))
+      return TRUE;
+    bzero(entries, sizeof(Entry) * size);
+    generation= 0;
+    pruned_plans= 0;
+    reset();
+    return FALSE;
+  }
+
+  void reset()
+  {
+    generation++;
+    free_entries= (size_mask + 1) / 4 * 3;
+  }
+
+  /**
+    Check a partial plan against the memo, and add it there
+
+    @retval TRUE   An earlier partial plan with the same tables is not more
+                   expensive; this one need not be expanded
+    @retval FALSE  The partial plan has to be expanded
+  */
+  bool is_dominated(table_map tables, bool sort_table_first,
+                    double record_count, double read_time)
+  {
+    uint pos= (uint) ((tables * 0x9E3779B97F4A7C15ULL) >> 32) & size_mask;
+    Entry *entry;
+    for (;; pos= (pos + 1) & size_mask)
+    {
+      entry= entries + pos;
+      if (entry->generation != generation)
+        break;
+      if (entry->tables == tables &&
+          entry->sort_table_first == sort_table_first)
+      {
+        if (entry->record_count <= record_count &&
+            entry->read_time <= read_time)
+        {
+          pruned_plans++;
+          return TRUE;
+        }
+        if (record_count <= entry->record_count &&
+            read_time <= entry->read_time)
+        {
+          entry->record_count= record_count;
+          entry->read_time= read_time;
+        }
+        return FALSE;
+      }
+    }
+    if (free_entries)
+    {
+      free_entries--;
+      entry->generation= generation;
+      entry->tables= tables;
+      entry->sort_table_first= sort_table_first;
+      entry->record_count= record_count;
+      entry->read_time= read_time;
+    }
+    return FALSE;
+  }
+};
+
+
 /**
   Find a good, possibly optimal, query execution plan (QEP) by a greedy search.
 
@@ -7105,12 +7425,27 @@ greedy_search(JOIN      *join,
                                          :
                                          ~(table_map)0));
 
+  /*
+    Semi-join strategies make the cost of a partial plan depend on the
+    order of its tables, so partial plans with semi-join tables can't be
+    compared by their sets of tables.
+  */
+  Join_prefix_memo memo_buff, *memo= NULL;
+  if (prune_level == 1 &&
+      optimizer_flag(join->thd, OPTIMIZER_SWITCH_JOIN_PREFIX_MEMO) &&
+      size_remain >= JOIN_PREFIX_MEMO_MIN_TABLES && search_depth > 1 &&
+      !join->emb_sjm_nest && join->select_lex->sj_nests.is_empty() &&
+      !memo_buff.init(join->thd->mem_root, size_remain, search_depth))
+    memo= &memo_buff;
+
   do {
     /* Find the extension of the current QEP with the lowest cost */
     join->best_read= DBL_MAX;
+    if (memo)
+      memo->reset();
     if (best_extension_by_limited_search(join, remaining_tables, idx, record_count,
                                          read_time, search_depth, prune_level,
-                                         use_cond_selectivity))
+                                         use_cond_selectivity, memo))
       DBUG_RETURN(TRUE);
     /*
       'best_read < DBL_MAX' means that optimizer managed to find
@@ -7124,6 +7459,7 @@ greedy_search(JOIN      *join,
         'join->best_positions' contains a complete optimal extension of the
         current partial QEP.
       */
+      join->pruned_partial_plans= memo ? memo->pruned_plans : 0;
       DBUG_EXECUTE("opt", print_plan(join, n_tables,
                                      record_count, read_time, read_time,
                                      "optimal"););
@@ -7806,6 +8142,9 @@ double table_cond_selectivity(JOIN *join, uint idx, JOIN_TAB *s,
                           (values: 0 = EXHAUSTIVE, 1 = PRUNE_BY_TIME_OR_ROWS)
   @param use_cond_selectivity  specifies how the selectivity of the conditions
                           pushed to a table should be taken into account
+  @param memo             partial plans considered so far, used to skip
+                          partial plans that can't lead to a cheaper plan;
+                          NULL if not used
 
   @retval
     FALSE       ok
@@ -7821,7 +8160,8 @@ best_extension_by_limited_search(JOIN      *join,
                                  double    read_time,
                                  uint      search_depth,
                                  uint      prune_level,
-                                 uint      use_cond_selectivity)
+                                 uint      use_cond_selectivity,
+                                 Join_prefix_memo *memo)
 {
   DBUG_ENTER("best_extension_by_limited_search");
 
@@ -7942,6 +8282,21 @@ best_extension_by_limited_search(JOIN      *join,
                                         pushdown_cond_selectivity;
       if ( (search_depth > 1) && (remaining_tables & ~real_table_bit) & allowed_tables )
       { /* Recursively expand the current partial plan */
+        if (memo &&
+            memo->is_dominated(remaining_tables & ~real_table_bit,
+                               join->positions[join->const_tables].table->table ==
+                               join->sort_by_table,
+                               partial_join_cardinality, current_read_time))
+        {
+          DBUG_EXECUTE("opt", print_plan(join, idx+1,
+                                         current_record_count,
+                                         read_time,
+                                         current_read_time,
+                                         "pruned_by_memo"););
+          restore_prev_nj_state(s);
+          restore_prev_sj_state(remaining_tables, s, idx);
+          continue;
+        }
         swap_variables(JOIN_TAB*, join->best_ref[idx], *pos);
         if (best_extension_by_limited_search(join,
                                              remaining_tables & ~real_table_bit,
@@ -7950,7 +8305,8 @@ best_extension_by_limited_search(JOIN      *join,
                                              current_read_time,
                                              search_depth - 1,
                                              prune_level,
-                                             use_cond_selectivity))
+                                             use_cond_selectivity,
+                                             memo))
           DBUG_RETURN(TRUE);
         swap_variables(JOIN_TAB*, join->best_ref[idx], *pos);
       }
@@ -16181,7 +16537,7 @@ create_tmp_table(THD *thd, TMP_TABLE_PARAM *param, List<Item> &fields,
   bool  use_packed_rows= false;
   bool  not_all_columns= !(select_options & TMP_TABLE_ALL_COLUMNS);
   char  *tmpname,path[FN_REFLEN];
-  uchar	*pos, *group_buff, *bitmaps;
+  uchar	*pos, *group_buff, *last_group_buff, *bitmaps;
   uchar *null_flags;
   Field **reg_field, **from_field, **default_field;
   uint *blob_field;
@@ -16290,6 +16646,8 @@ create_tmp_table(THD *thd, TMP_TABLE_PARAM *param, List<Item> &fields,
                         &tmpname, (uint) strlen(path)+1,
                         &group_buff, (group && ! using_unique_constraint ?
                                       param->group_length : 0),
+                        &last_group_buff, (group && ! using_unique_constraint ?
+                                           param->group_length : 0),
                         &bitmaps, bitmap_buffer_size(field_count)*5,
                         NullS))
   {
@@ -16747,6 +17105,8 @@ create_tmp_table(THD *thd, TMP_TABLE_PARAM *param, List<Item> &fields,
     DBUG_PRINT("info",("Creating group key in temporary table"));
     table->group=group;				/* Table is grouped by key */
     param->group_buff=group_buff;
+    param->last_group_buff= last_group_buff;
+    param->last_group_found= 0;
     share->keys=1;
     share->uniques= MY_TEST(using_unique_constraint);
     table->key_info= table->s->key_info= keyinfo;
@@ -17837,6 +18197,7 @@ do_select(JOIN *join,List<Item> *fields,TABLE *table,Procedure *procedure)
   {
     (void) table->file->extra(HA_EXTRA_WRITE_CACHE);
     empty_record(table);
+    join->tmp_table_param.last_group_found= 0;
     if (table->group && join->tmp_table_param.sum_func_count &&
         table->s->keys && !table->file->inited)
     {
@@ -19698,7 +20059,16 @@ end_update(JOIN *join, JOIN_TAB *join_tab __attribute__((unused)),
     if (item->maybe_null)
       group->buff[-1]= (char) group->field->is_null();
   }
-  if (!table->file->ha_index_read_map(table->record[1],
+  /*
+    Rows often arrive in runs of the same group. If this row has the same
+    key as the previous one, the HEAP table is still positioned on that
+    group and record[1] holds it, so the index lookup can be skipped.
+  */
+  if ((join->tmp_table_param.last_group_found &&
+       !memcmp(join->tmp_table_param.group_buff,
+               join->tmp_table_param.last_group_buff,
+               join->tmp_table_param.group_length)) ||
+      !table->file->ha_index_read_map(table->record[1],
                                       join->tmp_table_param.group_buff,
                                       HA_WHOLE_KEY,
                                       HA_READ_KEY_EXACT))
@@ -19711,9 +20081,18 @@ end_update(JOIN *join, JOIN_TAB *join_tab __attribute__((unused)),
       table->file->print_error(error,MYF(0));	/* purecov: inspected */
       DBUG_RETURN(NESTED_LOOP_ERROR);            /* purecov: inspected */
     }
+    if (table->s->db_type() == heap_hton)
+    {
+      store_record(table,record[1]);
+      memcpy(join->tmp_table_param.last_group_buff,
+             join->tmp_table_param.group_buff,
+             join->tmp_table_param.group_length);
+      join->tmp_table_param.last_group_found= 1;
+    }
     goto end;
   }
 
+  join->tmp_table_param.last_group_found= 0;
   init_tmptable_sum_functions(join->sum_funcs);
   if (copy_funcs(join->tmp_table_param.items_to_copy, join->thd))
     DBUG_RETURN(NESTED_LOOP_ERROR);           /* purecov: inspected */
@@ -23999,6 +24378,9 @@ void JOIN_TAB::save_explain_data(Explain_table_access *eta,
   {
     eta->quick_info= select->quick->get_explain(thd->mem_root);
   }
+  if (tab_type == JT_RANGE || tab_type == JT_HASH_RANGE ||
+      tab_type == JT_INDEX_MERGE || tab_type == JT_HASH_INDEX_MERGE)
+    eta->coarsened_ranges= table->quick_coarsened_keys;
 
   if (key_info) /* 'index' or 'ref' access */
   {
@@ -24357,6 +24739,7 @@ int JOIN::save_explain_data_intern(Explain_query *output, bool need_tmp_table,
     join->select_lex->set_explain_type(true);
     xpl_sel->select_id= join->select_lex->select_number;
     xpl_sel->select_type= join->select_lex->type;
+    xpl_sel->pruned_partial_plans= join->pruned_partial_plans;
     if (select_lex->master_unit()->derived)
       xpl_sel->connection_type= Explain_node::EXPLAIN_NODE_DERIVED;
 
@@ -25304,8 +25687,12 @@ JOIN::reoptimize(Item *added_where, table_map join_tables,
   if (optimize_semijoin_nests(this, join_tables))
     return REOPT_ERROR;
 
-  /* Re-run the join optimizer to compute a new query plan. */
-  if (choose_plan(this, join_tables))
+  /*
+    Re-run the join optimizer to compute a new query plan. The cached join
+    order was chosen without the new access methods, so it is neither
+    reused nor replaced.
+  */
+  if (choose_plan(this, join_tables, FALSE))
     return REOPT_ERROR;
 
   return REOPT_NEW_PLAN;
@@ -1135,6 +1135,11 @@ class JOIN :public Sql_alloc
     join->positions[i].records_read of a JOIN.
   */
   double   join_record_count;
+  /*
+    Number of partial plans that the join order search did not expand,
+    because a cheaper one with the same tables was already found
+  */
+  uint     pruned_partial_plans;
   List<Item> *fields;
   List<Cached_item> group_fields, group_fields_cache;
   TABLE    *tmp_table;
@@ -1350,6 +1355,7 @@ class JOIN :public Sql_alloc
     found_records= 0;
     fetch_limit= HA_POS_ERROR;
     join_examined_rows= 0;
+    pruned_partial_plans= 0;
     exec_tmp_table1= 0;
     exec_tmp_table2= 0;
     sortorder= 0;
@@ -1869,7 +1875,8 @@ inline Item * and_items(THD *thd, Item* cond, Item *item)
 {
   return (cond ? (new (thd->mem_root) Item_cond_and(thd, cond, item)) : item);
 }
-bool choose_plan(JOIN *join, table_map join_tables);
+bool choose_plan(JOIN *join, table_map join_tables,
+                 bool use_order_cache= TRUE);
 void optimize_wo_join_buffering(JOIN *join, uint first_tab, uint last_tab, 
                                 table_map last_remaining_tables, 
                                 bool first_alt, uint no_jbuf_before,
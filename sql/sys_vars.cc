@@ -2391,6 +2391,7 @@ export const char *optimizer_switch_names[]=
   "table_elimination",
   "extended_keys",
   "exists_to_in",
+  "join_prefix_memo",
   "default", NullS
 };
 static bool fix_optimizer_switch(sys_var *self, THD *thd,
@@ -2572,6 +2573,15 @@ static Sys_var_ulong Sys_range_alloc_block_size(
        VALID_RANGE(RANGE_ALLOC_BLOCK_SIZE, UINT_MAX),
        DEFAULT(RANGE_ALLOC_BLOCK_SIZE), BLOCK_SIZE(1024));
 
+static Sys_var_ulonglong Sys_range_optimizer_max_mem_size(
+       "range_optimizer_max_mem_size",
+       "Memory the range optimizer may use for the ranges of one table. "
+       "Once it is used up, the ranges of each further index condition "
+       "are merged into one. 0 means no limit",
+       SESSION_VAR(range_optimizer_max_mem_size), CMD_LINE(REQUIRED_ARG),
+       VALID_RANGE(0, (ulonglong)~(intptr)0), DEFAULT(64*1024*1024),
+       BLOCK_SIZE(1));
+
 static Sys_var_ulong Sys_multi_range_count(
        "multi_range_count", "Ignored. Use mrr_buffer_size instead",
        SESSION_VAR(multi_range_count), CMD_LINE(REQUIRED_ARG),
@@ -1181,6 +1181,13 @@ struct TABLE
   */
   ha_rows       quick_condition_rows;
 
+  /*
+    Number of range trees that the range optimizer replaced with coarser
+    ones in its last analysis of this table because it ran out of memory,
+    see @@range_optimizer_max_mem_size. Shown in EXPLAIN FORMAT=JSON.
+  */
+  uint          quick_coarsened_keys;
+
   double cond_selectivity;
   List<st_cond_statistic> *cond_selectivity_sampling_explain;
 
@@ -368,7 +368,11 @@ Unique::~Unique()
 }
 
 
-    /* Write tree to disk; clear tree */
+/*
+  Write tree to disk; clear tree.
+  The memory of the tree is kept for the next chunk of elements; callers
+  that are done adding elements free it with delete_tree().
+*/
 bool Unique::flush()
 {
   BUFFPEK file_ptr;
@@ -383,7 +387,7 @@ bool Unique::flush()
 		(void*) this, left_root_right) ||
       insert_dynamic(&file_ptrs, (uchar*) &file_ptr))
     return 1;
-  delete_tree(&tree);
+  reset_tree(&tree);
   return 0;
 }
 
@@ -640,6 +644,7 @@ bool Unique::walk(TABLE *table, tree_walk_action action, void *walk_action_arg)
   /* flush current tree to the file to have some memory for merge buffer */
   if (flush())
     return 1;
+  delete_tree(&tree);
   if (flush_io_cache(&file) || reinit_io_cache(&file, READ_CACHE, 0L, 0, 0))
     return 1;
   size_t buff_sz= (max_in_memory_size / full_size + 1) * full_size;
@@ -773,6 +778,7 @@ bool Unique::get(TABLE *table)
   /* Not enough memory; Save the result to file && free memory used by tree */
   if (flush())
     return 1;
+  delete_tree(&tree);
   size_t buff_sz= (max_in_memory_size / full_size + 1) * full_size;
   if (!(sort_buffer= (uchar*) my_malloc(buff_sz, MYF(MY_THREAD_SPECIFIC|MY_WME))))
     return 1;
@@ -49,6 +49,12 @@ bool flag_statements_digest= true;
 */
 volatile uint32 digest_index;
 bool digest_full= false;
+/**
+  Number of times the digest table was reset.
+  Thread digest buffers started before a reset are discarded,
+  as their digest record may now hold another digest.
+*/
+static volatile uint32 digest_reset_count= 0;
 
 LF_HASH digest_hash;
 static bool digest_hash_inited= false;
@@ -175,6 +181,88 @@ static LF_PINS* get_digest_hash_pins(PFS_thread *thread)
   return thread->m_digest_hash_pins;
 }
 
+/**
+  Start buffering the next executions of a digest in the thread.
+  @param thread the running thread
+  @param pfs the digest record of the current statement
+  @param digest_storage the tokens of the current statement
+  @param now when the current statement ended
+*/
+static void start_digest_buffer(PFS_thread *thread,
+                                PFS_statements_digest_stat *pfs,
+                                const sql_digest_storage *digest_storage,
+                                ulonglong now)
+{
+  PFS_digest_buffer *buffer= &thread->m_digest_buffer;
+  memcpy(&buffer->m_digest_key, &pfs->m_digest_key, sizeof(PFS_digest_key));
+  buffer->m_byte_count= 0;
+  if (buffer->m_token_array != NULL &&
+      digest_storage->m_byte_count <= pfs_max_digest_length)
+  {
+    buffer->m_byte_count= digest_storage->m_byte_count;
+    memcpy(buffer->m_token_array, digest_storage->m_token_array,
+           buffer->m_byte_count);
+  }
+  buffer->m_reset_count= digest_reset_count;
+  buffer->m_first_seen= now;
+  buffer->m_last_seen= now;
+  buffer->m_stat.reset();
+  /* Set last, readers of other threads match buffers by this record. */
+  buffer->m_digest_stat= pfs;
+}
+
+/**
+  Aggregate the digest buffer of a thread to its digest record.
+  @param thread the thread that owns the buffer
+*/
+void flush_digest_buffer(PFS_thread *thread)
+{
+  PFS_digest_buffer *buffer= &thread->m_digest_buffer;
+  PFS_statements_digest_stat *pfs= buffer->m_digest_stat;
+
+  if (pfs == NULL)
+    return;
+  buffer->m_digest_stat= NULL;
+
+  if (buffer->m_reset_count != digest_reset_count ||
+      buffer->m_stat.m_timer1_stat.m_count == 0)
+    return;
+
+  pfs->m_stat.aggregate(& buffer->m_stat);
+  if (pfs->m_last_seen < buffer->m_last_seen)
+    pfs->m_last_seen= buffer->m_last_seen;
+}
+
+/**
+  Aggregate the digest buffers of all threads for a digest record.
+  The buffers are read without a lock, like the digest records,
+  so a statement that ends meanwhile may be missed.
+  @param pfs the digest record
+  @param [out] stat the statement stat to aggregate to
+  @param [out] last_seen the last execution of the digest
+*/
+void aggregate_digest_buffers(PFS_statements_digest_stat *pfs,
+                              PFS_statement_stat *stat,
+                              ulonglong *last_seen)
+{
+  uint32 reset_count= digest_reset_count;
+  PFS_thread *thread= thread_array;
+  PFS_thread *thread_last= thread_array + thread_max;
+
+  for ( ; thread < thread_last; thread++)
+  {
+    PFS_digest_buffer *buffer= &thread->m_digest_buffer;
+    if (buffer->m_digest_stat != pfs ||
+        buffer->m_reset_count != reset_count ||
+        ! thread->m_lock.is_populated())
+      continue;
+
+    stat->aggregate(& buffer->m_stat);
+    if (*last_seen < buffer->m_last_seen)
+      *last_seen= buffer->m_last_seen;
+  }
+}
+
 PFS_statement_stat*
 find_or_create_digest(PFS_thread *thread,
                       const sql_digest_storage *digest_storage,
@@ -200,8 +288,19 @@ find_or_create_digest(PFS_thread *thread,
   */
   PFS_digest_key hash_key;
   memset(& hash_key, 0, sizeof(hash_key));
-  /* Compute MD5 Hash of the tokens received. */
-  compute_digest_md5(digest_storage, hash_key.m_md5);
+  /*
+    Compute MD5 Hash of the tokens received, unless they are the tokens
+    of the digest buffered by this thread: comparing the tokens is much
+    cheaper than hashing them again.
+  */
+  PFS_digest_buffer *buffer= &thread->m_digest_buffer;
+  if (buffer->m_digest_stat != NULL &&
+      buffer->m_byte_count == digest_storage->m_byte_count &&
+      memcmp(buffer->m_token_array, digest_storage->m_token_array,
+             buffer->m_byte_count) == 0)
+    memcpy(hash_key.m_md5, buffer->m_digest_key.m_md5, MD5_HASH_SIZE);
+  else
+    compute_digest_md5(digest_storage, hash_key.m_md5);
   memcpy((void*)& digest_storage->m_md5, &hash_key.m_md5, MD5_HASH_SIZE);
   /* Add the current schema to the key */
   hash_key.m_schema_name_length= schema_name_length;
@@ -217,6 +316,19 @@ find_or_create_digest(PFS_thread *thread,
 
   ulonglong now= my_hrtime().val;
 
+  if (buffer->m_digest_stat != NULL)
+  {
+    if (memcmp(&buffer->m_digest_key, &hash_key, sizeof(PFS_digest_key)) == 0 &&
+        buffer->m_reset_count == digest_reset_count &&
+        now - buffer->m_first_seen < DIGEST_BUFFER_INTERVAL)
+    {
+      /* Same digest as the last statement, aggregate to the thread. */
+      buffer->m_last_seen= now;
+      return & buffer->m_stat;
+    }
+    flush_digest_buffer(thread);
+  }
+
 search:
 
   /* Lookup LF_HASH using this new key. */
@@ -230,6 +342,7 @@ find_or_create_digest(PFS_thread *thread,
     pfs= *entry;
     pfs->m_last_seen= now;
     lf_hash_search_unpin(pins);
+    start_digest_buffer(thread, pfs, digest_storage, now);
     return & pfs->m_stat;
   }
 
@@ -278,6 +391,7 @@ find_or_create_digest(PFS_thread *thread,
   res= lf_hash_insert(&digest_hash, pins, &pfs);
   if (likely(res == 0))
   {
+    start_digest_buffer(thread, pfs, digest_storage, now);
     return & pfs->m_stat;
   }
 
@@ -346,6 +460,9 @@ void reset_esms_by_digest()
   if (unlikely(thread == NULL))
     return;
 
+  PFS_atomic::add_u32(& digest_reset_count, 1);
+  thread->m_digest_buffer.m_digest_stat= NULL;
+
   /* Reset statements_digest_stat_array. */
   for (size_t index= 0; index < digest_max; index++)
   {
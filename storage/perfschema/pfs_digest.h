@@ -63,6 +63,45 @@ struct PFS_ALIGNED PFS_statements_digest_stat
   void reset_index(PFS_thread *thread);
 };
 
+/**
+  Statement stats of a thread for its last digest, not yet aggregated
+  to the digest record.
+  Consecutive executions of the same statement by a thread are
+  aggregated here instead of to the shared digest record, so that a hot
+  digest does not bounce the cache line of its record between threads.
+  The first execution of a digest in a row is aggregated directly, so
+  every digest is visible at once.
+  The buffer is flushed to the digest record when the thread executes
+  another digest, after @c DIGEST_BUFFER_INTERVAL, and when the thread ends.
+  Readers of EVENTS_STATEMENTS_SUMMARY_BY_DIGEST add the buffers of all
+  threads to the digest record, so idle threads are not left out.
+*/
+struct PFS_digest_buffer
+{
+  /** Digest record to flush to, NULL if the buffer is not in use. */
+  PFS_statements_digest_stat *m_digest_stat;
+  /** Key of the digest record. */
+  PFS_digest_key m_digest_key;
+  /**
+    Tokens of the digest, to reuse its MD5 hash for the next statements
+    that have the same tokens. NULL if digests are not collected.
+  */
+  unsigned char *m_token_array;
+  /** Length of @c m_token_array, 0 if the tokens did not fit. */
+  uint m_byte_count;
+  /** Value of @c digest_reset_count when the buffer was started. */
+  uint32 m_reset_count;
+  /** When the buffer was started. */
+  ulonglong m_first_seen;
+  /** Last execution aggregated in the buffer. */
+  ulonglong m_last_seen;
+  /** Buffered statement stat. */
+  PFS_statement_stat m_stat;
+};
+
+/** Maximum age of a digest buffer, in microseconds. */
+#define DIGEST_BUFFER_INTERVAL 1000000
+
 int init_digest(const PFS_global_param *param);
 void cleanup_digest();
 
@@ -73,6 +112,11 @@ PFS_statement_stat* find_or_create_digest(PFS_thread *thread,
                                           const char *schema_name,
                                           uint schema_name_length);
 
+void flush_digest_buffer(PFS_thread *thread);
+void aggregate_digest_buffers(PFS_statements_digest_stat *pfs,
+                              PFS_statement_stat *stat,
+                              ulonglong *last_seen);
+
 void reset_esms_by_digest();
 
 /* Exposing the data directly, for iterators. */
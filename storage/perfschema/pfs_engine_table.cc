@@ -1343,12 +1343,25 @@ bool pfs_show_status(handlerton *hton, THD *thd,
       size= digest_max * pfs_max_digest_length;
       total_memory+= size;
       break;
+    case 166:
+      name= "(thread_digest_buffer_token_array).row_count";
+      size= (digest_max > 0) ? thread_max : 0;
+      break;
+    case 167:
+      name= "(thread_digest_buffer_token_array).row_size";
+      size= pfs_max_digest_length;
+      break;
+    case 168:
+      name= "(thread_digest_buffer_token_array).memory";
+      size= (digest_max > 0) ? thread_max * pfs_max_digest_length : 0;
+      total_memory+= size;
+      break;
 
     /*
       This case must be last,
       for aggregation in total_memory.
     */
-    case 166:
+    case 169:
       name= "performance_schema.memory";
       size= total_memory;
       /* This will fail if something is not advertised here */
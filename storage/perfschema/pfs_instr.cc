@@ -179,6 +179,7 @@ static PFS_events_statements *thread_statements_history_array= NULL;
 static PFS_events_statements *thread_statements_stack_array= NULL;
 static unsigned char *current_stmts_digest_token_array= NULL;
 static unsigned char *history_stmts_digest_token_array= NULL;
+static unsigned char *buffer_digest_token_array= NULL;
 static char *thread_session_connect_attrs_array= NULL;
 
 /** Hash table for instrumented files. */
@@ -265,6 +266,8 @@ int init_instruments(const PFS_global_param *param)
 
   size_t current_digest_tokens_sizing= param->m_thread_sizing * pfs_max_digest_length * statement_stack_max;
   size_t history_digest_tokens_sizing= param->m_thread_sizing * pfs_max_digest_length * events_statements_history_per_thread;
+  size_t buffer_digest_tokens_sizing= (param->m_digest_sizing > 0) ?
+    param->m_thread_sizing * pfs_max_digest_length : 0;
 
   mutex_array= NULL;
   rwlock_array= NULL;
@@ -280,6 +283,7 @@ int init_instruments(const PFS_global_param *param)
   thread_statements_stack_array= NULL;
   current_stmts_digest_token_array= NULL;
   history_stmts_digest_token_array= NULL;
+  buffer_digest_token_array= NULL;
   thread_instr_class_waits_array= NULL;
   thread_instr_class_stages_array= NULL;
   thread_instr_class_statements_array= NULL;
@@ -437,6 +441,14 @@ int init_instruments(const PFS_global_param *param)
       return 1;
   }
 
+  if (buffer_digest_tokens_sizing > 0)
+  {
+    buffer_digest_token_array=
+      (unsigned char *)pfs_malloc(buffer_digest_tokens_sizing, MYF(MY_ZEROFILL));
+    if (unlikely(buffer_digest_token_array == NULL))
+      return 1;
+  }
+
   for (index= 0; index < thread_max; index++)
   {
     thread_array[index].m_waits_history=
@@ -455,6 +467,9 @@ int init_instruments(const PFS_global_param *param)
       &thread_instr_class_statements_array[index * statement_class_max];
     thread_array[index].m_session_connect_attrs=
       &thread_session_connect_attrs_array[index * session_connect_attrs_size_per_thread];
+    if (buffer_digest_token_array != NULL)
+      thread_array[index].m_digest_buffer.m_token_array=
+        &buffer_digest_token_array[index * pfs_max_digest_length];
   }
 
   for (index= 0; index < thread_statements_stack_sizing; index++)
@@ -551,6 +566,8 @@ void cleanup_instruments(void)
   current_stmts_digest_token_array= NULL;
   pfs_free(history_stmts_digest_token_array);
   history_stmts_digest_token_array= NULL;
+  pfs_free(buffer_digest_token_array);
+  buffer_digest_token_array= NULL;
 }
 
 C_MODE_START
@@ -977,6 +994,7 @@ PFS_thread* create_thread(PFS_thread_class *klass, const void *identity,
         pfs->m_account_hash_pins= NULL;
         pfs->m_host_hash_pins= NULL;
         pfs->m_digest_hash_pins= NULL;
+        pfs->m_digest_buffer.m_digest_stat= NULL;
 
         pfs->m_username_length= 0;
         pfs->m_hostname_length= 0;
@@ -1169,6 +1187,7 @@ void destroy_thread(PFS_thread *pfs)
     lf_hash_put_pins(pfs->m_host_hash_pins);
     pfs->m_host_hash_pins= NULL;
   }
+  flush_digest_buffer(pfs);
   if (pfs->m_digest_hash_pins)
   {
     lf_hash_put_pins(pfs->m_digest_hash_pins);
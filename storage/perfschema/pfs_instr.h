@@ -397,6 +397,8 @@ struct PFS_ALIGNED PFS_thread : PFS_connection_slice
   LF_PINS *m_account_hash_pins;
   /** Pins for digest_hash. */
   LF_PINS *m_digest_hash_pins;
+  /** Statement stats buffered for the last digest. */
+  PFS_digest_buffer m_digest_buffer;
   /** Internal thread identifier, unique. */
   ulonglong m_thread_internal_id;
   /** Parent internal thread identifier. */
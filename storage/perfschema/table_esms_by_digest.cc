@@ -153,10 +153,13 @@ void table_esms_by_digest::make_row(PFS_statements_digest_stat* digest_stat)
   m_row.m_digest.make_row(digest_stat);
 
   /*
-    Get statements stats.
+    Get statements stats, with the executions still buffered by threads.
   */
+  PFS_statement_stat stat= digest_stat->m_stat;
+  aggregate_digest_buffers(digest_stat, & stat, & m_row.m_last_seen);
+
   time_normalizer *normalizer= time_normalizer::get(statement_timer);
-  m_row.m_stat.set(normalizer, & digest_stat->m_stat);
+  m_row.m_stat.set(normalizer, & stat);
 
   m_row_exists= true;
 }
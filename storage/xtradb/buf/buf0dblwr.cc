@@ -155,6 +155,7 @@ buf_dblwr_init(
 	buf_dblwr->first_free = 0;
 	buf_dblwr->s_reserved = 0;
 	buf_dblwr->b_reserved = 0;
+	buf_dblwr->b_copying = 0;
 
 	buf_dblwr->block1 = mach_read_from_4(
 		doublewrite + TRX_SYS_DOUBLEWRITE_BLOCK1);
@@ -955,6 +956,17 @@ buf_dblwr_flush_buffered_writes(void)
 	buf_dblwr->batch_running = true;
 	first_free = buf_dblwr->first_free;
 
+	/* Wait for the threads that reserved a slot in this batch to
+	finish copying their page to write_buf. No new slot can be
+	reserved while batch_running is set. */
+	while (buf_dblwr->b_copying > 0) {
+		ib_int64_t	sig_count = os_event_reset(buf_dblwr->b_event);
+		mutex_exit(&buf_dblwr->mutex);
+
+		os_event_wait_low(buf_dblwr->b_event, sig_count);
+		mutex_enter(&buf_dblwr->mutex);
+	}
+
 	/* Now safe to release the mutex. Note that though no other
 	thread is allowed to post to the doublewrite batch flushing
 	but any threads working on single page flushes are allowed
@@ -1073,6 +1085,7 @@ buf_dblwr_add_to_batch(
 	buf_page_t*	bpage)	/*!< in: buffer block to write */
 {
 	ulint	zip_size;
+	ulint	slot;
 
 	ut_a(buf_page_in_file(bpage));
 	ut_ad(!mutex_own(&buf_pool_from_bpage(bpage)->LRU_list_mutex));
@@ -1105,46 +1118,58 @@ buf_dblwr_add_to_batch(
 		goto try_again;
 	}
 
+	/* Reserve a slot, and copy the page to it after releasing the
+	mutex, so that the threads posting to the batch do not serialize
+	on the copying. The batch is not started before b_copying drops
+	to zero. */
+
+	slot = buf_dblwr->first_free;
+
+	buf_dblwr->buf_block_arr[slot] = bpage;
+
+	buf_dblwr->first_free++;
+	buf_dblwr->b_reserved++;
+	buf_dblwr->b_copying++;
+
+	ut_ad(!buf_dblwr->batch_running);
+	ut_ad(buf_dblwr->first_free == buf_dblwr->b_reserved);
+	ut_ad(buf_dblwr->b_reserved <= srv_doublewrite_batch_size);
+
+	mutex_exit(&(buf_dblwr->mutex));
+
 	zip_size = buf_page_get_zip_size(bpage);
 	void * frame = buf_page_get_frame(bpage);
 
 	if (zip_size) {
 		UNIV_MEM_ASSERT_RW(bpage->zip.data, zip_size);
 		/* Copy the compressed page and clear the rest. */
-		memcpy(buf_dblwr->write_buf
-		       + UNIV_PAGE_SIZE * buf_dblwr->first_free,
-                       frame, zip_size);
-		memset(buf_dblwr->write_buf
-		       + UNIV_PAGE_SIZE * buf_dblwr->first_free
+		memcpy(buf_dblwr->write_buf + UNIV_PAGE_SIZE * slot,
+		       frame, zip_size);
+		memset(buf_dblwr->write_buf + UNIV_PAGE_SIZE * slot
 		       + zip_size, 0, UNIV_PAGE_SIZE - zip_size);
 	} else {
 		ut_a(buf_page_get_state(bpage) == BUF_BLOCK_FILE_PAGE);
 		UNIV_MEM_ASSERT_RW(((buf_block_t*) bpage)->frame,
 				   UNIV_PAGE_SIZE);
 
-		memcpy(buf_dblwr->write_buf
-		       + UNIV_PAGE_SIZE * buf_dblwr->first_free,
+		memcpy(buf_dblwr->write_buf + UNIV_PAGE_SIZE * slot,
 		       frame, UNIV_PAGE_SIZE);
 	}
 
-	buf_dblwr->buf_block_arr[buf_dblwr->first_free] = bpage;
+	mutex_enter(&(buf_dblwr->mutex));
 
-	buf_dblwr->first_free++;
-	buf_dblwr->b_reserved++;
+	ut_ad(buf_dblwr->b_copying > 0);
 
-	ut_ad(!buf_dblwr->batch_running);
-	ut_ad(buf_dblwr->first_free == buf_dblwr->b_reserved);
-	ut_ad(buf_dblwr->b_reserved <= srv_doublewrite_batch_size);
+	if (--buf_dblwr->b_copying == 0 && buf_dblwr->batch_running) {
+		os_event_set(buf_dblwr->b_event);
+	}
 
-	if (buf_dblwr->first_free == srv_doublewrite_batch_size) {
-		mutex_exit(&(buf_dblwr->mutex));
+	mutex_exit(&(buf_dblwr->mutex));
 
-		buf_dblwr_flush_buffered_writes();
+	if (slot + 1 == srv_doublewrite_batch_size) {
 
-		return;
+		buf_dblwr_flush_buffered_writes();
 	}
-
-	mutex_exit(&(buf_dblwr->mutex));
 }
 
 /********************************************************************//**
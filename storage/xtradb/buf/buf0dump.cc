@@ -30,8 +30,10 @@ Created April 08, 2011 Vasil Dimov
 
 #include "buf0buf.h" /* srv_buf_pool_instances */
 #include "buf0dump.h"
+#include "buf0rea.h" /* buf_read_page_async() */
 #include "db0err.h"
 #include "dict0dict.h" /* dict_operation_lock */
+#include "fil0fil.h" /* fil_space_get_zip_size() */
 #include "os0file.h" /* OS_FILE_MAX_PATH */
 #include "os0sync.h" /* os_event* */
 #include "os0thread.h" /* os_thread_* */
@@ -624,13 +626,28 @@ buf_load()
 
 	ut_free(dump_tmp);
 
-	ulint	last_check_time = 0;
-	ulint	last_activity_cnt = 0;
+	ulint		last_check_time = 0;
+	ulint		last_activity_cnt = 0;
+	ulint		cur_space_id = ULINT_UNDEFINED;
+	ulint		zip_size = ULINT_UNDEFINED;
+	ib_int64_t	tablespace_version = 0;
 
 	for (i = 0; i < dump_n && !SHUTTING_DOWN(); i++) {
 
-		buf_read_page_async(BUF_DUMP_SPACE(dump[i]),
-				    BUF_DUMP_PAGE(dump[i]));
+		/* The dump is sorted by tablespace: look up each tablespace
+		once instead of once for every page of it. */
+		if (BUF_DUMP_SPACE(dump[i]) != cur_space_id) {
+			cur_space_id = BUF_DUMP_SPACE(dump[i]);
+			zip_size = fil_space_get_zip_size(cur_space_id);
+			tablespace_version = fil_space_get_version(
+				cur_space_id);
+		}
+
+		if (zip_size != ULINT_UNDEFINED) {
+			buf_read_page_async(cur_space_id, zip_size,
+					    tablespace_version,
+					    BUF_DUMP_PAGE(dump[i]));
+		}
 
 		if (i % 64 == 63) {
 			os_aio_simulated_wake_handler_threads();
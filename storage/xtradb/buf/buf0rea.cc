@@ -493,27 +493,24 @@ buf_read_page(
 High-level function which reads a page asynchronously from a file to the
 buffer buf_pool if it is not already there. Sets the io_fix flag and sets
 an exclusive lock on the buffer frame. The flag is cleared and the x-lock
-released by the i/o-handler thread.
+released by the i/o-handler thread. The caller looks up the tablespace,
+so that it can do that once for a run of pages of the same tablespace.
 @return TRUE if page has been read in, FALSE in case of failure */
 UNIV_INTERN
 ibool
 buf_read_page_async(
 /*================*/
-	ulint	space,	/*!< in: space id */
-	ulint	offset)	/*!< in: page number */
+	ulint		space,	/*!< in: space id */
+	ulint		zip_size,/*!< in: compressed page size, or 0 */
+	ib_int64_t	tablespace_version,
+				/*!< in: version of the tablespace, as
+				returned by fil_space_get_version() */
+	ulint		offset)	/*!< in: page number */
 {
-	ulint		zip_size;
-	ib_int64_t	tablespace_version;
 	ulint		count;
 	dberr_t		err;
 
-	zip_size = fil_space_get_zip_size(space);
-
-	if (zip_size == ULINT_UNDEFINED) {
-		return(FALSE);
-	}
-
-	tablespace_version = fil_space_get_version(space);
+	ut_ad(zip_size != ULINT_UNDEFINED);
 
 	count = buf_read_page_low(&err, true, BUF_READ_ANY_PAGE
 				  | OS_AIO_SIMULATED_WAKE_LATER
@@ -823,6 +820,47 @@ buf_read_ahead_linear(
 	return(count);
 }
 
+/********************************************************************//**
+Issues an asynchronous read of the next leaf page of an index, unless
+the page is already in the buffer pool. Unlike linear read-ahead, this
+follows the leaf chain, so it also helps when the leaf pages are not
+stored in order in the file. The caller must have the page that points
+to the next leaf page latched.
+@return number of page read requests issued */
+UNIV_INTERN
+ulint
+buf_read_ahead_leaf(
+/*================*/
+	ulint	space,		/*!< in: space id */
+	ulint	zip_size,	/*!< in: compressed page size in bytes, or 0 */
+	ulint	offset)		/*!< in: page number of the next leaf page */
+{
+	buf_pool_t*	buf_pool = buf_pool_get(space, offset);
+	ulint		count;
+	dberr_t		err;
+
+	if (!srv_read_ahead_threshold
+	    || UNIV_UNLIKELY(srv_startup_is_before_trx_rollback_phase)
+	    || buf_page_peek(space, offset)) {
+
+		return(0);
+	}
+
+	if (buf_pool->n_pend_reads
+	    > buf_pool->curr_size / BUF_READ_AHEAD_PEND_LIMIT) {
+
+		return(0);
+	}
+
+	count = buf_read_page_low(&err, false, BUF_READ_ANY_PAGE,
+				  space, zip_size, FALSE,
+				  fil_space_get_version(space), offset,
+				  NULL, NULL);
+
+	buf_pool->stat.n_ra_pages_read += count;
+	return(count);
+}
+
 /********************************************************************//**
 Issues read requests for pages which the ibuf module wants to read in, in
 order to contract the insert buffer tree. Technically, this function is like
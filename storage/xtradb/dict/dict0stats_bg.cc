@@ -176,6 +176,25 @@ dict_stats_recalc_pool_get(
 	return(true);
 }
 
+/*****************************************************************//**
+Get the number of tables in the auto recalc pool.
+@return number of tables waiting for their stats to be recalculated */
+static
+ulint
+dict_stats_recalc_pool_len()
+/*========================*/
+{
+	ulint	len;
+
+	mutex_enter(&recalc_pool_mutex);
+
+	len = recalc_pool.size();
+
+	mutex_exit(&recalc_pool_mutex);
+
+	return(len);
+}
+
 /*****************************************************************//**
 Delete a given table from the auto recalc pool.
 dict_stats_recalc_pool_del() */
@@ -557,7 +576,17 @@ DECLARE_THREAD(dict_stats_thread)(
 		}
 #endif
 
-		dict_stats_process_entry_from_recalc_pool();
+		/* Process all the tables that are in the pool now, not
+		only the first one, which would leave each of the others
+		waiting for a wakeup of its own. A table put back in the
+		pool because its stats are too recent goes to the end of
+		the pool and is looked at again on the next round only. */
+		for (ulint n = dict_stats_recalc_pool_len();
+		     n > 0 && !SHUTTING_DOWN();
+		     n--) {
+
+			dict_stats_process_entry_from_recalc_pool();
+		}
 
 		while (defrag_pool.size())
 			dict_stats_process_entry_from_defrag_pool();
@@ -83,6 +83,44 @@ static ulint srv_data_read, srv_data_written;
 /* Used for debugging */
 //#define UNIV_PAGECOMPRESS_DEBUG 1
 
+/****************************************************************//**
+Reports a failure to compress a page. The tablespace is only looked up
+here, so that the compression of a page does not need fil_system->mutex. */
+static
+void
+fil_compress_page_failed(
+/*=====================*/
+	ulint	space_id,	/*!< in: tablespace id */
+	ulint	len,		/*!< in: length of the page */
+	int	err,		/*!< in: error code of the compressor */
+	ulint	write_size)	/*!< in: compressed size reached */
+{
+	srv_stats.pages_page_compression_error.inc();
+
+	fil_system_enter();
+
+	fil_space_t*	space = fil_space_get_by_id(space_id);
+
+#ifndef UNIV_PAGECOMPRESS_DEBUG
+	if (space == NULL || space->printed_compression_failure) {
+		fil_system_exit();
+		return;
+	}
+#endif /* !UNIV_PAGECOMPRESS_DEBUG */
+
+	ib_logf(IB_LOG_LEVEL_WARN,
+		"Compression failed for space %lu name %s len %lu"
+		" err %d write_size %lu.",
+		space_id, space ? fil_space_name(space) : "",
+		len, err, write_size);
+
+	if (space != NULL) {
+		space->printed_compression_failure = true;
+	}
+
+	fil_system_exit();
+}
+
 /****************************************************************//**
 For page compressed pages compress the page before actual write
 operation.
@@ -136,9 +174,11 @@ fil_compress_page(
 	/* read original page type */
 	orig_page_type = mach_read_from_2(buf + FIL_PAGE_TYPE);
 
+#ifdef UNIV_PAGECOMPRESS_DEBUG
 	fil_system_enter();
 	fil_space_t* space = fil_space_get_by_id(space_id);
 	fil_system_exit();
+#endif /* UNIV_PAGECOMPRESS_DEBUG */
 
 	/* Let's not compress file space header or
 	extent descriptor */
@@ -175,17 +215,7 @@ fil_compress_page(
 		if (err == 0) {
 			/* If error we leave the actual page as it was */
 
-#ifndef UNIV_PAGECOMPRESS_DEBUG
-			if (space->printed_compression_failure == false) {
-#endif
-				ib_logf(IB_LOG_LEVEL_WARN,
-					"Compression failed for space %lu name %s len %lu rt %d write %lu.",
-					space_id, fil_space_name(space), len, err, write_size);
-				space->printed_compression_failure = true;
-#ifndef UNIV_PAGECOMPRESS_DEBUG
-			}
-#endif
-			srv_stats.pages_page_compression_error.inc();
+			fil_compress_page_failed(space_id, len, err, write_size);
 			*out_len = len;
 			goto err_exit;
 		}
@@ -197,14 +227,7 @@ fil_compress_page(
 			buf, len, out_buf+header_len, &write_size, lzo_mem);
 
 		if (err != LZO_E_OK || write_size > UNIV_PAGE_SIZE-header_len) {
-			if (space->printed_compression_failure == false) {
-				ib_logf(IB_LOG_LEVEL_WARN,
-					"Compression failed for space %lu name %s len %lu err %d write_size %lu.",
-					space_id, fil_space_name(space), len, err, write_size);
-				space->printed_compression_failure = true;
-			}
-
-			srv_stats.pages_page_compression_error.inc();
+			fil_compress_page_failed(space_id, len, err, write_size);
 			*out_len = len;
 			goto err_exit;
 		}
@@ -226,14 +249,7 @@ fil_compress_page(
 			(size_t)write_size);
 
 		if (err != LZMA_OK || out_pos > UNIV_PAGE_SIZE-header_len) {
-			if (space->printed_compression_failure == false) {
-				ib_logf(IB_LOG_LEVEL_WARN,
-					"Compression failed for space %lu name %s len %lu err %d write_size %lu",
-					space_id, fil_space_name(space), len, err, out_pos);
-				space->printed_compression_failure = true;
-			}
-
-			srv_stats.pages_page_compression_error.inc();
+			fil_compress_page_failed(space_id, len, err, out_pos);
 			*out_len = len;
 			goto err_exit;
 		}
@@ -257,14 +273,7 @@ fil_compress_page(
 			0);
 
 		if (err != BZ_OK || write_size > UNIV_PAGE_SIZE-header_len) {
-			if (space->printed_compression_failure == false) {
-				ib_logf(IB_LOG_LEVEL_WARN,
-					"Compression failed for space %lu name %s len %lu err %d write_size %lu.",
-					space_id, fil_space_name(space), len, err, write_size);
-				space->printed_compression_failure = true;
-			}
-
-			srv_stats.pages_page_compression_error.inc();
+			fil_compress_page_failed(space_id, len, err, write_size);
 			*out_len = len;
 			goto err_exit;
 		}
@@ -284,14 +293,7 @@ fil_compress_page(
 			(size_t*)&write_size);
 
 		if (cstatus != SNAPPY_OK || write_size > UNIV_PAGE_SIZE-header_len) {
-			if (space->printed_compression_failure == false) {
-				ib_logf(IB_LOG_LEVEL_WARN,
-					"Compression failed for space %lu name %s len %lu err %d write_size %lu.",
-					space_id, fil_space_name(space), len, (int)cstatus, write_size);
-				space->printed_compression_failure = true;
-			}
-
-			srv_stats.pages_page_compression_error.inc();
+			fil_compress_page_failed(space_id, len, (int)cstatus, write_size);
 			*out_len = len;
 			goto err_exit;
 		}
@@ -305,14 +307,7 @@ fil_compress_page(
 		if (err != Z_OK) {
 			/* If error we leave the actual page as it was */
 
-			if (space->printed_compression_failure == false) {
-				ib_logf(IB_LOG_LEVEL_WARN,
-					"Compression failed for space %lu name %s len %lu rt %d write %lu.",
-					space_id, fil_space_name(space), len, err, write_size);
-				space->printed_compression_failure = true;
-			}
-
-			srv_stats.pages_page_compression_error.inc();
+			fil_compress_page_failed(space_id, len, err, write_size);
 			*out_len = len;
 			goto err_exit;
 		}
@@ -1050,7 +1050,7 @@ fts_words_free(
 	/* Free the resources held by a word. */
 	for (rbt_node = rbt_first(words);
 	     rbt_node != NULL;
-	     rbt_node = rbt_first(words)) {
+	     rbt_node = rbt_next(words, rbt_node)) {
 
 		ulint			i;
 		fts_tokenizer_word_t*	word;
@@ -1066,10 +1066,11 @@ fts_words_free(
 			ut_free(fts_node->ilist);
 			fts_node->ilist = NULL;
 		}
-
-		/* NOTE: We are responsible for free'ing the node */
-		ut_free(rbt_remove_node(words, rbt_node));
 	}
+
+	/* Free the nodes all at once; removing them one by one would
+	rebalance the tree after every word. */
+	rbt_clear(words);
 }
 
 /*********************************************************************//**
@@ -3965,7 +3966,7 @@ fts_sync_write_words(
 	since we want to free the memory used during caching. */
 	for (rbt_node = rbt_first(index_cache->words);
 	     rbt_node;
-	     rbt_node = rbt_first(index_cache->words)) {
+	     rbt_node = rbt_next(index_cache->words, rbt_node)) {
 
 		ulint			i;
 		ulint			selected;
@@ -4027,11 +4028,12 @@ fts_sync_write_words(
 
 			print_error = TRUE;
 		}
-
-		/* NOTE: We are responsible for free'ing the node */
-		ut_free(rbt_remove_node(index_cache->words, rbt_node));
 	}
 
+	/* The ilists have been freed above: free the word nodes in one
+	go instead of removing every word from the tree separately. */
+	rbt_clear(index_cache->words);
+
 #ifdef FTS_DOC_STATS_DEBUG
 	if (error == DB_SUCCESS && n_new_words > 0 && fts_enable_diag_print) {
 		fts_table_t	fts_table;
@@ -63,6 +63,9 @@ typedef std::vector<fts_string_t>	word_vector_t;
 
 struct fts_word_freq_t;
 
+/** Term frequency entries of 'word_vector', by word position */
+typedef std::vector<fts_word_freq_t*>	word_freq_vector_t;
+
 /** State of an FTS query. */
 struct fts_query_t {
 	mem_heap_t*	heap;		/*!< Heap to use for allocations */
@@ -3360,7 +3363,10 @@ void
 fts_query_calculate_ranking(
 /*========================*/
 	const fts_query_t*	query,		/*!< in: query state */
-	fts_ranking_t*		ranking)	/*!< in: Document to rank */
+	fts_ranking_t*		ranking,	/*!< in: Document to rank */
+	word_freq_vector_t&	word_freqs)	/*!< in/out: term frequency
+						entries looked up so far,
+						by word position */
 {
 	ulint	pos = 0;
 	fts_string_t	word;
@@ -3369,6 +3375,7 @@ fts_query_calculate_ranking(
 	bound */
 	ut_ad(ranking->rank <= 1.0 && ranking->rank >= -1.0);
 	ut_ad(rbt_size(query->word_map) == query->word_vector->size());
+	ut_ad(word_freqs.size() == query->word_vector->size());
 
 	while (fts_ranking_words_get_next(query, ranking, &pos, &word)) {
 		int			ret;
@@ -3377,12 +3384,18 @@ fts_query_calculate_ranking(
 		fts_doc_freq_t*		doc_freq;
 		fts_word_freq_t*	word_freq;
 
-		ret = rbt_search(query->word_freqs, &parent, &word);
+		/* The position was advanced past the word */
+		word_freq = word_freqs[pos - 1];
 
-		/* It must exist. */
-		ut_a(ret == 0);
+		if (word_freq == NULL) {
+			ret = rbt_search(query->word_freqs, &parent, &word);
 
-		word_freq = rbt_value(fts_word_freq_t, parent.last);
+			/* It must exist. */
+			ut_a(ret == 0);
+
+			word_freq = rbt_value(fts_word_freq_t, parent.last);
+			word_freqs[pos - 1] = word_freq;
+		}
 
 		ret = rbt_search(
 			word_freq->doc_freqs, &parent, &ranking->doc_id);
@@ -3552,6 +3565,10 @@ fts_query_prepare_result(
 
 	ut_a(rbt_size(query->doc_ids) > 0);
 
+	/* Look up the term frequencies of each matched word only once,
+	not once for every document that contains it. */
+	word_freq_vector_t	word_freqs(query->word_vector->size());
+
 	for (node = rbt_first(query->doc_ids);
 	     node;
 	     node = rbt_next(query->doc_ids, node)) {
@@ -3559,7 +3576,7 @@ fts_query_prepare_result(
 		fts_ranking_t*	ranking;
 
 		ranking = rbt_value(fts_ranking_t, node);
-		fts_query_calculate_ranking(query, ranking);
+		fts_query_calculate_ranking(query, ranking, word_freqs);
 
 		// FIXME: I think we may requre this information to improve the
 		// ranking of doc ids which have more word matches from
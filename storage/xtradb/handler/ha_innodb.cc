@@ -526,6 +526,7 @@ static PSI_thread_info	all_innodb_threads[] = {
 	{&buf_page_cleaner_thread_key, "page_cleaner_thread", 0},
 	{&buf_lru_manager_thread_key, "lru_manager_thread", 0},
 	{&recv_writer_thread_key, "recv_writer_thread", 0},
+	{&recv_apply_thread_key, "recv_apply_thread", 0},
 	{&srv_log_tracking_thread_key, "srv_redo_log_follow_thread", 0}
 };
 # endif /* UNIV_PFS_THREAD */
@@ -1132,6 +1133,8 @@ static SHOW_VAR innodb_status_variables[]= {
 #endif /* UNIV_DEBUG */
   {"read_views_memory",
   (char*) &export_vars.innodb_read_views_memory,	  SHOW_LONG},
+  {"read_views_reused",
+  (char*) &export_vars.innodb_read_views_reused,	  SHOW_LONG},
   {"row_lock_current_waits",
   (char*) &export_vars.innodb_row_lock_current_waits,	  SHOW_LONG},
   {"row_lock_time",
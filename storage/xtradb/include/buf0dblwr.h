@@ -133,8 +133,13 @@ struct buf_dblwr_t{
 				measured in units of UNIV_PAGE_SIZE */
 	ulint		b_reserved;/*!< number of slots currently reserved
 				for batch flush. */
+	ulint		b_copying;/*!< number of slots reserved for batch
+				flush whose page is still being copied
+				to write_buf */
 	os_event_t	b_event;/*!< event where threads wait for a
-				batch flush to end. */
+				batch flush to end, and where the
+				thread starting a batch waits for
+				b_copying to reach zero. */
 	ulint		s_reserved;/*!< number of slots currently
 				reserved for single page flushes. */
 	os_event_t	s_event;/*!< event where threads wait for a
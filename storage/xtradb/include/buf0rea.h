@@ -50,14 +50,19 @@ buf_read_page(
 High-level function which reads a page asynchronously from a file to the
 buffer buf_pool if it is not already there. Sets the io_fix flag and sets
 an exclusive lock on the buffer frame. The flag is cleared and the x-lock
-released by the i/o-handler thread.
+released by the i/o-handler thread. The caller looks up the tablespace,
+so that it can do that once for a run of pages of the same tablespace.
 @return TRUE if page has been read in, FALSE in case of failure */
 UNIV_INTERN
 ibool
 buf_read_page_async(
 /*================*/
-	ulint	space,	/*!< in: space id */
-	ulint	offset);/*!< in: page number */
+	ulint		space,	/*!< in: space id */
+	ulint		zip_size,/*!< in: compressed page size, or 0 */
+	ib_int64_t	tablespace_version,
+				/*!< in: version of the tablespace, as
+				returned by fil_space_get_version() */
+	ulint		offset);/*!< in: page number */
 /********************************************************************//**
 Applies a random read-ahead in buf_pool if there are at least a threshold
 value of accessed pages from the random read-ahead area. Does not read any
@@ -118,6 +123,20 @@ buf_read_ahead_linear(
 	ibool	inside_ibuf,	/*!< in: TRUE if we are inside ibuf routine */
 	trx_t*	trx);
 /********************************************************************//**
+Issues an asynchronous read of the next leaf page of an index, unless
+the page is already in the buffer pool. Unlike linear read-ahead, this
+follows the leaf chain, so it also helps when the leaf pages are not
+stored in order in the file. The caller must have the page that points
+to the next leaf page latched.
+@return number of page read requests issued */
+UNIV_INTERN
+ulint
+buf_read_ahead_leaf(
+/*================*/
+	ulint	space,		/*!< in: space id */
+	ulint	zip_size,	/*!< in: compressed page size in bytes, or 0 */
+	ulint	offset);	/*!< in: page number of the next leaf page */
+/********************************************************************//**
 Issues read requests for pages which the ibuf module wants to read in, in
 order to contract the insert buffer tree. Technically, this function is like
 a read-ahead function. */
@@ -427,6 +427,12 @@ struct recv_sys_t{
 	ib_mutex_t		writer_mutex;/*!< mutex coordinating
 				flushing between recv_writer_thread and
 				the recovery thread. */
+	ulint		apply_next_cell;
+				/*!< next addr_hash cell to be handed out
+				to a thread applying a batch */
+	ulint		n_apply_threads;
+				/*!< number of recv_apply_thread instances
+				that have not exited yet */
 #endif /* !UNIV_HOTBACKUP */
 	ibool		apply_log_recs;
 				/*!< this is TRUE when log rec application to
@@ -482,6 +488,8 @@ struct recv_sys_t{
 	hash_table_t*	addr_hash;/*!< hash table of file addresses of pages */
 	ulint		n_addrs;/*!< number of not processed hashed file
 				addresses in the hash table */
+	recv_addr_t*	last_addr;/*!< the hashed file address that the
+				previous log record was added to, or NULL */
 
 	recv_dblwr_t	dblwr;
 };
@@ -530,6 +538,11 @@ times! */
 roll-forward */
 #define RECV_SCAN_SIZE		(4 * UNIV_PAGE_SIZE)
 
+/** Upper limit of the size of block reads when the log groups are scanned
+forward, if the log buffer is big enough; the rest of the parsing buffer
+is left for the unparsed tail of the previous read */
+#define RECV_SCAN_BULK_SIZE	(RECV_PARSING_BUF_SIZE / 8)
+
 /** This many frames must be left free in the buffer pool when we scan
 the log and store the scanned log records in the buffer pool: we will
 use these free frames to read in pages when we start applying the
@@ -831,6 +831,12 @@ struct row_prebuilt_t {
 	ulint		n_rows_fetched;	/*!< number of rows fetched after
 					positioning the current cursor */
 	ulint		fetch_direction;/*!< ROW_SEL_NEXT or ROW_SEL_PREV */
+	ulint		unique_page_no;	/*!< leaf page of the clustered
+					index where the last unique search
+					ended, or FIL_NULL */
+	ulint		n_unique_pages_fwd;/*!< number of consecutive
+					unique searches that moved from
+					unique_page_no to its successor */
 	byte*		fetch_cache[MYSQL_FETCH_CACHE_SIZE];
 					/*!< a cache for fetched rows if we
 					fetch many rows from the same cursor:
@@ -183,6 +183,9 @@ struct srv_stats_t {
 	/** Number of lock deadlocks */
 	ulint_ctr_1_t		lock_deadlock_count;
 
+	/** Number of read views reused without copying the descriptors */
+	ulint_ctr_1_t		n_read_views_reused;
+
 	/** Number of lock waits that have been up to max time (i.e.) lock
 	wait timeout */
 	ulint_ctr_1_t		n_lock_max_wait_time;
@@ -725,6 +728,7 @@ extern mysql_pfs_key_t	srv_monitor_thread_key;
 extern mysql_pfs_key_t	srv_master_thread_key;
 extern mysql_pfs_key_t	srv_purge_thread_key;
 extern mysql_pfs_key_t	recv_writer_thread_key;
+extern mysql_pfs_key_t	recv_apply_thread_key;
 extern mysql_pfs_key_t	srv_log_tracking_thread_key;
 
 /* This macro register the current thread and its key with performance
@@ -1179,6 +1183,7 @@ struct export_var_t{
 	ulint innodb_truncated_status_writes;	/*!< srv_truncated_status_writes */
 	ulint innodb_available_undo_logs;       /*!< srv_available_undo_logs */
 	ulint innodb_read_views_memory;		/*!< srv_read_views_memory */
+	ulint innodb_read_views_reused;		/*!< srv_stats.n_read_views_reused */
 	ulint innodb_descriptors_memory;	/*!< srv_descriptors_memory */
 	ib_int64_t innodb_s_lock_os_waits;
 	ib_int64_t innodb_s_lock_spin_rounds;
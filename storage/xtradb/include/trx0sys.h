@@ -684,6 +684,10 @@ struct trx_sys_t{
 					descr_n_used */
 	ulint		descr_n_used;	/*!< Number of used elements in the
 					descriptors array. */
+	ulint		descr_version;	/*!< Incremented whenever a descriptor
+					is reserved or released; a read view
+					built at the same descr_version and
+					max_trx_id is still current */
 	char		pad3[64];	/*!< Ensure descriptors do not share
 					cache line with other fields */
 #ifdef UNIV_DEBUG
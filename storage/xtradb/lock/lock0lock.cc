@@ -5381,7 +5381,8 @@ lock_release(
 	ut_a(ib_vector_is_empty(trx->autoinc_locks));
 	ut_a(ib_vector_is_empty(trx->lock.table_locks));
 
-	mem_heap_empty(trx->lock.lock_heap);
+	/* The lock heap is emptied by the caller after releasing
+	lock_sys->mutex, see lock_trx_release_locks(). */
 }
 
 /* True if a lock mode is S or X */
@@ -7661,6 +7662,14 @@ lock_trx_release_locks(
 	lock_release(trx);
 
 	lock_mutex_exit();
+
+	/* Free the memory of the released locks only now, so that
+	other transactions do not wait for lock_sys->mutex while the
+	heap blocks are freed. No lock can be created for trx any
+	more, because it is no longer active: the implicit to explicit
+	lock conversion checks that under lock_sys->mutex. */
+
+	mem_heap_empty(trx->lock.lock_heap);
 }
 
 /*********************************************************************//**
@@ -84,6 +84,10 @@ this must be less than UNIV_PAGE_SIZE as it is stored in the buffer pool */
 /** Read-ahead area in applying log records to file pages */
 #define RECV_READ_AHEAD_AREA	32
 
+/** Maximum number of threads applying a batch of log records, including
+the recovery thread itself */
+#define RECV_APPLY_MAX_THREADS	16
+
 /** The recovery system */
 UNIV_INTERN recv_sys_t*	recv_sys = NULL;
 /** TRUE when applying redo log records during crash recovery; FALSE
@@ -179,6 +183,7 @@ UNIV_INTERN mysql_pfs_key_t	recv_sys_mutex_key;
 #ifndef UNIV_HOTBACKUP
 # ifdef UNIV_PFS_THREAD
 UNIV_INTERN mysql_pfs_key_t	recv_writer_thread_key;
+UNIV_INTERN mysql_pfs_key_t	recv_apply_thread_key;
 # endif /* UNIV_PFS_THREAD */
 
 # ifdef UNIV_PFS_MUTEX
@@ -427,6 +432,7 @@ recv_sys_init(
 
 	recv_sys->addr_hash = hash_create(available_memory / 512);
 	recv_sys->n_addrs = 0;
+	recv_sys->last_addr = NULL;
 
 	recv_sys->apply_log_recs = FALSE;
 	recv_sys->apply_batch_on = FALSE;
@@ -472,6 +478,7 @@ recv_sys_empty_hash(void)
 	mem_heap_empty(recv_sys->heap);
 
 	recv_sys->addr_hash = hash_create(buf_pool_get_curr_size() / 512);
+	recv_sys->last_addr = NULL;
 
 	return DB_SUCCESS;
 }
@@ -1502,7 +1509,17 @@ recv_add_to_hash_table(
 	recv->start_lsn = start_lsn;
 	recv->end_lsn = end_lsn;
 
-	recv_addr = recv_get_fil_addr_struct(space, page_no);
+	/* The records of a mini-transaction mostly refer to the same
+	page: check the previous one before searching the hash table */
+
+	recv_addr = recv_sys->last_addr;
+
+	if (recv_addr == NULL
+	    || recv_addr->space != space
+	    || recv_addr->page_no != page_no) {
+
+		recv_addr = recv_get_fil_addr_struct(space, page_no);
+	}
 
 	if (recv_addr == NULL) {
 		recv_addr = static_cast<recv_addr_t*>(
@@ -1523,6 +1540,8 @@ recv_add_to_hash_table(
 #endif
 	}
 
+	recv_sys->last_addr = recv_addr;
+
 	UT_LIST_ADD_LAST(rec_list, recv_addr->rec_list, recv);
 
 	prev_field = &(recv->data);
@@ -1857,6 +1876,108 @@ recv_read_in_area(
 	return(n);
 }
 
+/*******************************************************************//**
+Applies the hashed log records of one addr_hash cell. Pages which are in
+the buffer pool are recovered right away; the others are read in, and
+the i/o handler threads apply their log records on read completion. */
+static
+void
+recv_apply_hashed_cell(
+/*===================*/
+	ulint	i)	/*!< in: addr_hash cell number */
+{
+	recv_addr_t*	recv_addr;
+	mtr_t		mtr;
+
+	mutex_enter(&(recv_sys->mutex));
+
+	for (recv_addr = static_cast<recv_addr_t*>(
+			HASH_GET_FIRST(recv_sys->addr_hash, i));
+	     recv_addr != 0;
+	     recv_addr = static_cast<recv_addr_t*>(
+			HASH_GET_NEXT(addr_hash, recv_addr))) {
+
+		ulint	space = recv_addr->space;
+		ulint	zip_size = fil_space_get_zip_size(space);
+		ulint	page_no = recv_addr->page_no;
+
+		if (recv_addr->state != RECV_NOT_PROCESSED) {
+
+			continue;
+		}
+
+		mutex_exit(&(recv_sys->mutex));
+
+		if (buf_page_peek(space, page_no)) {
+			buf_block_t*	block;
+
+			mtr_start(&mtr);
+
+			block = buf_page_get(
+				space, zip_size, page_no,
+				RW_X_LATCH, &mtr);
+			buf_block_dbg_add_level(
+				block, SYNC_NO_ORDER_CHECK);
+
+			recv_recover_page(FALSE, block);
+			mtr_commit(&mtr);
+		} else {
+			recv_read_in_area(space, zip_size, page_no);
+		}
+
+		mutex_enter(&(recv_sys->mutex));
+	}
+
+	mutex_exit(&(recv_sys->mutex));
+}
+
+/*******************************************************************//**
+Hands out the next addr_hash cell of the current apply batch.
+@return cell number, or ULINT_UNDEFINED if all cells have been handed out */
+static
+ulint
+recv_apply_next_cell(void)
+/*======================*/
+{
+	ulint	i = os_atomic_increment_ulint(&recv_sys->apply_next_cell, 1)
+		- 1;
+
+	return(i < hash_get_n_cells(recv_sys->addr_hash)
+	       ? i : ULINT_UNDEFINED);
+}
+
+/******************************************************************//**
+Helper thread of recv_apply_hashed_log_recs(): applies addr_hash cells
+until all of them have been handed out.
+@return a dummy parameter */
+extern "C" UNIV_INTERN
+os_thread_ret_t
+DECLARE_THREAD(recv_apply_thread)(
+/*==============================*/
+	void*	arg __attribute__((unused)))
+			/*!< in: a dummy parameter required by
+			os_thread_create */
+{
+	ulint	i;
+
+#ifdef UNIV_PFS_THREAD
+	pfs_register_thread(recv_apply_thread_key);
+#endif /* UNIV_PFS_THREAD */
+
+	while ((i = recv_apply_next_cell()) != ULINT_UNDEFINED) {
+		recv_apply_hashed_cell(i);
+	}
+
+	os_atomic_decrement_ulint(&recv_sys->n_apply_threads, 1);
+
+	/* We count the number of threads in os_thread_exit().
+	A created thread should always use that to exit and not
+	use return() to exit. */
+	os_thread_exit(NULL);
+
+	OS_THREAD_DUMMY_RETURN;
+}
+
 /*******************************************************************//**
 Empties the hash table of stored log records, applying them to appropriate
 pages.
@@ -1875,11 +1996,11 @@ recv_apply_hashed_log_recs(
 				the caller must in this case own the log
 				mutex */
 {
-	recv_addr_t* recv_addr;
 	ulint	i;
+	ulint	n_threads;
 	ibool	has_printed	= FALSE;
-	ulong progress;
-	mtr_t	mtr;
+	ulong	progress;
+	ulong	last_progress	= ULONG_UNDEFINED;
 	dberr_t err = DB_SUCCESS;
 loop:
 	mutex_enter(&(recv_sys->mutex));
@@ -1902,66 +2023,61 @@ recv_apply_hashed_log_recs(
 	recv_sys->apply_log_recs = TRUE;
 	recv_sys->apply_batch_on = TRUE;
 
-	for (i = 0; i < hash_get_n_cells(recv_sys->addr_hash); i++) {
+	if (recv_sys->n_addrs != 0) {
+		ib_logf(IB_LOG_LEVEL_INFO,
+			"Starting an apply batch of log records"
+			" to the database...");
+		fputs("InnoDB: Progress in percent: ", stderr);
+		has_printed = TRUE;
+	}
 
-		for (recv_addr = static_cast<recv_addr_t*>(
-				HASH_GET_FIRST(recv_sys->addr_hash, i));
-		     recv_addr != 0;
-		     recv_addr = static_cast<recv_addr_t*>(
-				HASH_GET_NEXT(addr_hash, recv_addr))) {
+	/* The cells of addr_hash are handed out one at a time to the
+	helper threads and to this thread, so that the pages already in
+	the buffer pool are recovered and the reads of the others are
+	issued in parallel. */
 
-			ulint	space = recv_addr->space;
-			ulint	zip_size = fil_space_get_zip_size(space);
-			ulint	page_no = recv_addr->page_no;
+	recv_sys->apply_next_cell = 0;
+	recv_sys->n_apply_threads = 0;
 
-			if (recv_addr->state == RECV_NOT_PROCESSED) {
-				if (!has_printed) {
-					ib_logf(IB_LOG_LEVEL_INFO,
-						"Starting an apply batch"
-						" of log records"
-						" to the database...");
-					fputs("InnoDB: Progress in percent: ",
-					      stderr);
-					has_printed = TRUE;
-				}
+	if (has_printed) {
+		n_threads = ut_min(srv_n_read_io_threads,
+				   RECV_APPLY_MAX_THREADS);
 
-				mutex_exit(&(recv_sys->mutex));
+		for (i = 1; i < n_threads; i++) {
+			os_atomic_increment_ulint(
+				&recv_sys->n_apply_threads, 1);
+			os_thread_create(recv_apply_thread, NULL, NULL);
+		}
+	}
 
-				if (buf_page_peek(space, page_no)) {
-					buf_block_t*	block;
+	mutex_exit(&(recv_sys->mutex));
 
-					mtr_start(&mtr);
+	while ((i = recv_apply_next_cell()) != ULINT_UNDEFINED) {
 
-					block = buf_page_get(
-						space, zip_size, page_no,
-						RW_X_LATCH, &mtr);
-					buf_block_dbg_add_level(
-						block, SYNC_NO_ORDER_CHECK);
+		recv_apply_hashed_cell(i);
 
-					recv_recover_page(FALSE, block);
-					mtr_commit(&mtr);
-				} else {
-					recv_read_in_area(space, zip_size,
-							  page_no);
-				}
+		progress = (ulong) (i * 100)
+			/ hash_get_n_cells(recv_sys->addr_hash);
 
-				mutex_enter(&(recv_sys->mutex));
-			}
-		}
+		if (has_printed && progress != last_progress) {
 
-                progress = (ulong) (i * 100)
-                                   / hash_get_n_cells(recv_sys->addr_hash);
-		if (has_printed
-		    && progress
-		    != ((i + 1) * 100)
-		    / hash_get_n_cells(recv_sys->addr_hash)) {
+			last_progress = progress;
 
-                        fprintf(stderr, "%lu ", progress);
-                        sd_notifyf(0, "STATUS=Applying batch of log records for"
-                                   " InnoDB: Progress %lu", progress);
+			fprintf(stderr, "%lu ", progress);
+			sd_notifyf(0, "STATUS=Applying batch of log records for"
+				   " InnoDB: Progress %lu", progress);
 		}
 	}
 
+	/* Wait until the helper threads have stopped looking at the hash
+	table */
+
+	while (os_atomic_increment_ulint(&recv_sys->n_apply_threads, 0)) {
+		os_thread_sleep(10000);
+	}
+
+	mutex_enter(&(recv_sys->mutex));
+
 	/* Wait until all the pages have been processed */
 
 	while (recv_sys->n_addrs != 0) {
@@ -3005,14 +3121,23 @@ recv_group_scan_log_recs(
 	ibool	finished;
 	lsn_t	start_lsn;
 	lsn_t	end_lsn;
+	ulint	scan_size;
 
 	finished = FALSE;
 	*err = DB_SUCCESS;
 
 	start_lsn = *contiguous_lsn;
 
+	/* Read and parse the log in pieces bigger than RECV_SCAN_SIZE
+	when the log buffer allows it: this saves read calls and moves of
+	the parsing buffer when the log to be recovered is long */
+
+	scan_size = ut_min(log_sys->buf_size, RECV_SCAN_BULK_SIZE);
+	ut_ad(scan_size >= RECV_SCAN_SIZE);
+	ut_ad(scan_size % OS_FILE_LOG_BLOCK_SIZE == 0);
+
 	while (!finished) {
-		end_lsn = start_lsn + RECV_SCAN_SIZE;
+		end_lsn = start_lsn + scan_size;
 
 		log_group_read_log_seg(LOG_RECOVER, log_sys->buf,
 				       group, start_lsn, end_lsn, FALSE);
@@ -3021,7 +3146,7 @@ recv_group_scan_log_recs(
 			(buf_pool_get_n_pages()
 			- (recv_n_pool_free_frames * srv_buf_pool_instances))
 			* UNIV_PAGE_SIZE,
-			TRUE, log_sys->buf, RECV_SCAN_SIZE,
+			TRUE, log_sys->buf, scan_size,
 			start_lsn, contiguous_lsn, group_scanned_lsn,
 			err);
 
@@ -826,6 +826,9 @@ row_create_prebuilt(
 	btr_pcur_reset(&prebuilt->pcur);
 	btr_pcur_reset(&prebuilt->clust_pcur);
 
+	prebuilt->unique_page_no = FIL_NULL;
+	prebuilt->n_unique_pages_fwd = 0;
+
 	prebuilt->select_lock_type = LOCK_NONE;
 	prebuilt->stored_select_lock_type = LOCK_NONE_UNSET;
 
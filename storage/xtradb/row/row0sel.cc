@@ -57,6 +57,7 @@ Created 12/19/1997 Heikki Tuuri
 #include "row0mysql.h"
 #include "read0read.h"
 #include "buf0lru.h"
+#include "buf0rea.h"
 #include "srv0srv.h"
 #include "ha_prototypes.h"
 #include "srv0start.h"
@@ -3397,6 +3398,75 @@ row_sel_dequeue_cached_row_for_mysql(
 	}
 }
 
+/* After this many unique searches in a row have each moved on to the
+next leaf page, the searches are assumed to follow the leaf chain */
+#define ROW_SEL_UNIQUE_READ_AHEAD_THRESHOLD	2
+
+/********************************************************************//**
+Follows the leaf pages on which unique searches in the clustered index
+end. Sorted row references, such as those of a Multi-Range Read, make
+these searches walk the leaf chain forward; once they do, the leaf page
+after the current one should be read ahead, so that the next searches
+find it in the buffer pool.
+Only a move to the immediate successor leaf counts as walking forward.
+Page numbers do not follow the key order, so a search that skips leaf
+pages cannot be told from a jump backwards; it resets the count, and
+sparse row references get no read-ahead.
+@return page number of the leaf page to read ahead, or FIL_NULL */
+static
+ulint
+row_sel_unique_read_ahead_page(
+/*===========================*/
+	row_prebuilt_t*	prebuilt,	/*!< in/out: prebuilt struct */
+	btr_pcur_t*	pcur,		/*!< in: cursor positioned on a leaf
+					page of the clustered index */
+	mtr_t*		mtr)		/*!< in: mtr holding the page latch */
+{
+	const buf_block_t*	block = btr_pcur_get_block(pcur);
+	ulint			page_no = buf_block_get_page_no(block);
+	ulint			next_page_no = FIL_NULL;
+
+	if (page_no == prebuilt->unique_page_no) {
+
+		return(FIL_NULL);
+	}
+
+	if (btr_page_get_prev(buf_block_get_frame(block), mtr)
+	    != prebuilt->unique_page_no) {
+
+		prebuilt->n_unique_pages_fwd = 0;
+
+	} else if (++prebuilt->n_unique_pages_fwd
+		   >= ROW_SEL_UNIQUE_READ_AHEAD_THRESHOLD) {
+
+		next_page_no = btr_page_get_next(buf_block_get_frame(block),
+						 mtr);
+	}
+
+	prebuilt->unique_page_no = page_no;
+
+	return(next_page_no);
+}
+
+/********************************************************************//**
+Issues an asynchronous read of a leaf page of the clustered index that
+row_sel_unique_read_ahead_page() chose. The caller must not hold the
+adaptive hash index latch: reading the page may evict another one,
+which drops the hash index entries of that page. */
+static
+void
+row_sel_unique_read_ahead(
+/*======================*/
+	const dict_index_t*	index,	/*!< in: clustered index */
+	ulint			page_no)/*!< in: page to read, or FIL_NULL */
+{
+	if (page_no != FIL_NULL) {
+		buf_read_ahead_leaf(dict_index_get_space(index),
+				    dict_table_zip_size(index->table),
+				    page_no);
+	}
+}
+
 /********************************************************************//**
 Initialise the prefetch cache. */
 UNIV_INLINE
@@ -3491,6 +3561,10 @@ row_sel_try_search_shortcut_for_mysql(
 	row_prebuilt_t*	prebuilt,/*!< in: prebuilt struct */
 	ulint**		offsets,/*!< in/out: for rec_get_offsets(*out_rec) */
 	mem_heap_t**	heap,	/*!< in/out: heap for rec_get_offsets() */
+	ulint*		read_ahead_page_no,
+				/*!< out: leaf page to read ahead once
+				the search latch is released, or
+				FIL_NULL */
 	mtr_t*		mtr)	/*!< in: started mtr */
 {
 	dict_index_t*	index		= prebuilt->index;
@@ -3515,6 +3589,8 @@ row_sel_try_search_shortcut_for_mysql(
 				   0,
 				   mtr);
 #endif /* UNIV_SEARCH_DEBUG */
+	*read_ahead_page_no = row_sel_unique_read_ahead_page(prebuilt, pcur,
+							     mtr);
 	rec = btr_pcur_get_rec(pcur);
 
 	if (!page_rec_is_user_rec(rec)) {
@@ -3682,6 +3758,7 @@ row_search_for_mysql(
 	ibool		mtr_has_extra_clust_latch	= FALSE;
 	ibool		moves_up			= FALSE;
 	ibool		set_also_gap_locks		= TRUE;
+	ulint		read_ahead_page_no		= FIL_NULL;
 	/* if the query is a plain locking SELECT, and the isolation level
 	is <= TRX_ISO_READ_COMMITTED, then this is set to FALSE */
 	ibool		did_semi_consistent_read	= FALSE;
@@ -3931,7 +4008,7 @@ row_search_for_mysql(
 #endif
 			switch (row_sel_try_search_shortcut_for_mysql(
 					&rec, prebuilt, &offsets, &heap,
-					&mtr)) {
+					&read_ahead_page_no, &mtr)) {
 			case SEL_FOUND:
 #ifdef UNIV_SEARCH_DEBUG
 				ut_a(0 == cmp_dtuple_rec(search_tuple,
@@ -3998,6 +4075,9 @@ row_search_for_mysql(
 					btr_search_get_latch(index));
 				trx->has_search_latch = FALSE;
 
+				row_sel_unique_read_ahead(index,
+							  read_ahead_page_no);
+
 				/* NOTE that we do NOT store the cursor
 				position */
 				goto func_exit;
@@ -4014,6 +4094,8 @@ row_search_for_mysql(
 
 			rw_lock_s_unlock(btr_search_get_latch(index));
 			trx->has_search_latch = FALSE;
+
+			row_sel_unique_read_ahead(index, read_ahead_page_no);
 		}
 	}
 
@@ -4148,6 +4230,13 @@ row_search_for_mysql(
 
 		rec = btr_pcur_get_rec(pcur);
 
+		if (unique_search && dict_index_is_clust(index)) {
+			row_sel_unique_read_ahead(
+				index,
+				row_sel_unique_read_ahead_page(
+					prebuilt, pcur, &mtr));
+		}
+
 		if (!moves_up
 		    && !page_rec_is_supremum(rec)
 		    && set_also_gap_locks
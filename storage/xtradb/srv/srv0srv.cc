@@ -1981,6 +1981,7 @@ srv_export_innodb_status(void)
 	export_vars.innodb_available_undo_logs = srv_available_undo_logs;
 	export_vars.innodb_read_views_memory
 		= os_atomic_increment_ulint(&srv_read_views_memory, 0);
+	export_vars.innodb_read_views_reused = srv_stats.n_read_views_reused;
 	export_vars.innodb_descriptors_memory
 		= os_atomic_increment_ulint(&srv_descriptors_memory, 0);
 
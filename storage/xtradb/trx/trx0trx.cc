@@ -175,6 +175,7 @@ trx_reserve_descriptor(
 	*descr = trx->id;
 
 	trx_sys->descr_n_used = n_used;
+	trx_sys->descr_version++;
 }
 
 /*************************************************************//**
@@ -190,6 +191,8 @@ trx_release_descriptor(
 
 	ut_ad(mutex_own(&trx_sys->mutex));
 
+	trx_sys->descr_version++;
+
 	if (UNIV_LIKELY(trx->in_trx_serial_list)) {
 
 		UT_LIST_REMOVE(trx_serial_list, trx_sys->trx_serial_list,
@@ -263,8 +266,11 @@ trx_create(void)
 
 	trx->lock.que_state = TRX_QUE_RUNNING;
 
+	/* Start with room for a few record locks, so that the common
+	short transaction does not grow the heap while holding
+	lock_sys->mutex. */
 	trx->lock.lock_heap = mem_heap_create_typed(
-		256, MEM_HEAP_FOR_LOCK_HEAP);
+		1024, MEM_HEAP_FOR_LOCK_HEAP);
 
 	trx->search_latch_timeout = BTR_SEA_TIMEOUT;
 
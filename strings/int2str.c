@@ -36,6 +36,22 @@ const char _dig_vec_upper[] =
 const char _dig_vec_lower[] =
   "0123456789abcdefghijklmnopqrstuvwxyz";
 
+/*
+  All two digit decimal numbers, used to convert two digits per division
+  in int10_to_str() and longlong10_to_str().
+*/
+const char _dig_pairs[201] =
+  "00010203040506070809"
+  "10111213141516171819"
+  "20212223242526272829"
+  "30313233343536373839"
+  "40414243444546474849"
+  "50515253545556575859"
+  "60616263646566676869"
+  "70717273747576777879"
+  "80818283848586878889"
+  "90919293949596979899";
+
 
 /*
   Convert integer to its string representation in given scale of notation.
@@ -146,8 +162,8 @@ char *int10_to_str(long int val,char *dst,int radix)
 {
   char buffer[65];
   register char *p;
-  long int new_val;
   unsigned long int uval = (unsigned long int) val;
+  size_t length;
 
   if (radix < 0)				/* -10 */
   {
@@ -161,16 +177,26 @@ char *int10_to_str(long int val,char *dst,int radix)
 
   p = &buffer[sizeof(buffer)-1];
   *p = '\0';
-  new_val= (long) (uval / 10);
-  *--p = '0'+ (char) (uval - (unsigned long) new_val * 10);
-  val = new_val;
-
-  while (val != 0)
+  /* Produce two digits per division, from the least significant end */
+  while (uval >= 100)
   {
-    new_val=val/10;
-    *--p = '0' + (char) (val-new_val*10);
-    val= new_val;
+    unsigned long int quo= uval / 100;
+    uint rem= (uint) (uval - quo * 100) * 2;
+    p-= 2;
+    p[0]= _dig_pairs[rem];
+    p[1]= _dig_pairs[rem + 1];
+    uval= quo;
   }
-  while ((*dst++ = *p++) != 0) ;
-  return dst-1;
+  if (uval >= 10)
+  {
+    p-= 2;
+    p[0]= _dig_pairs[uval * 2];
+    p[1]= _dig_pairs[uval * 2 + 1];
+  }
+  else
+    *--p = '0' + (char) uval;
+
+  length= (size_t) (&buffer[sizeof(buffer)-1] - p);
+  memcpy(dst, p, length + 1);
+  return dst + length;
 }
@@ -115,6 +115,7 @@ char *longlong10_to_str(longlong val,char *dst,int radix)
   register char *p;
   long long_val;
   ulonglong uval= (ulonglong) val;
+  size_t length;
 
   if (radix < 0)
   {
@@ -126,30 +127,39 @@ char *longlong10_to_str(longlong val,char *dst,int radix)
     }
   }
 
-  if (uval == 0)
-  {
-    *dst++='0';
-    *dst='\0';
-    return dst;
-  }
   p = &buffer[sizeof(buffer)-1];
   *p = '\0';
 
   while (uval > (ulonglong) LONG_MAX)
   {
-    ulonglong quo= uval/(uint) 10;
-    uint rem= (uint) (uval- quo* (uint) 10);
-    *--p = _dig_vec_upper[rem];
+    ulonglong quo= uval/(uint) 100;
+    uint rem= (uint) (uval- quo* (uint) 100) * 2;
+    p-= 2;
+    p[0]= _dig_pairs[rem];
+    p[1]= _dig_pairs[rem + 1];
     uval= quo;
   }
   long_val= (long) uval;
-  while (long_val != 0)
+  while (long_val >= 100)
   {
-    long quo= long_val/10;
-    *--p = _dig_vec_upper[(uchar) (long_val - quo*10)];
+    long quo= long_val/100;
+    uint rem= (uint) (long_val - quo*100) * 2;
+    p-= 2;
+    p[0]= _dig_pairs[rem];
+    p[1]= _dig_pairs[rem + 1];
     long_val= quo;
   }
-  while ((*dst++ = *p++) != 0) ;
-  return dst-1;
+  if (long_val >= 10)
+  {
+    p-= 2;
+    p[0]= _dig_pairs[long_val * 2];
+    p[1]= _dig_pairs[long_val * 2 + 1];
+  }
+  else
+    *--p = '0' + (char) long_val;
+
+  length= (size_t) (&buffer[sizeof(buffer)-1] - p);
+  memcpy(dst, p, length + 1);
+  return dst + length;
 }
 #endif
@@ -19440,6 +19440,100 @@ static void test_big_packet()
 }
 
 
+/*
+  The fetch that sends the last rows of a cursor also reports the end of
+  the data, so the client does not fetch again
+*/
+
+static int fetch_cursor_rows(MYSQL_STMT *stmt, int32 *a)
+{
+  int rc, num_rows= 0;
+
+  while ((rc= mysql_stmt_fetch(stmt)) == 0)
+  {
+    DIE_UNLESS(*a == ++num_rows);
+    /*
+      Fetched in batches of 5: the second batch ends with the 10th row and
+      already reports that it is the last one
+    */
+    DIE_UNLESS(((stmt->server_status & SERVER_STATUS_LAST_ROW_SENT) != 0) ==
+               (num_rows > 5));
+  }
+  DIE_UNLESS(rc == MYSQL_NO_DATA);
+  return num_rows;
+}
+
+static void test_cursor_last_row_sent()
+{
+  MYSQL_STMT *stmt;
+  MYSQL_BIND my_bind[1];
+  int32 a;
+  int rc, num_rows= 0;
+  const char *stmt_text;
+  ulong type= (ulong) CURSOR_TYPE_READ_ONLY;
+  ulong prefetch_rows= 5;
+
+  myheader("test_cursor_last_row_sent");
+
+  rc= mysql_query(mysql, "drop table if exists t1");
+  myquery(rc);
+  rc= mysql_query(mysql, "create table t1 (id integer not null primary key)");
+  myquery(rc);
+  rc= mysql_query(mysql, "insert into t1 (id) values "
+                         " (1), (2), (3), (4), (5), (6), (7), (8), (9), (10)");
+  myquery(rc);
+
+  stmt= mysql_stmt_init(mysql);
+  rc= mysql_stmt_attr_set(stmt, STMT_ATTR_CURSOR_TYPE, (void*) &type);
+  check_execute(stmt, rc);
+  rc= mysql_stmt_attr_set(stmt, STMT_ATTR_PREFETCH_ROWS,
+                          (void*) &prefetch_rows);
+  check_execute(stmt, rc);
+  stmt_text= "select id from t1 order by id";
+  rc= mysql_stmt_prepare(stmt, stmt_text, strlen(stmt_text));
+  check_execute(stmt, rc);
+
+  bzero((char*) my_bind, sizeof(my_bind));
+  my_bind[0].buffer_type= MYSQL_TYPE_LONG;
+  my_bind[0].buffer= (void*) &a;
+  my_bind[0].buffer_length= sizeof(a);
+  rc= mysql_stmt_bind_result(stmt, my_bind);
+  check_execute(stmt, rc);
+
+  /* The prefetch count ends exactly on the last row */
+  rc= mysql_stmt_execute(stmt);
+  check_execute(stmt, rc);
+  DIE_UNLESS(fetch_cursor_rows(stmt, &a) == 10);
+
+  /* Execute again after the server closed the cursor with the last row */
+  rc= mysql_stmt_execute(stmt);
+  check_execute(stmt, rc);
+  DIE_UNLESS(fetch_cursor_rows(stmt, &a) == 10);
+
+  /* Read all rows of the cursor at once */
+  rc= mysql_stmt_execute(stmt);
+  check_execute(stmt, rc);
+  rc= mysql_stmt_store_result(stmt);
+  check_execute(stmt, rc);
+  DIE_UNLESS(mysql_stmt_num_rows(stmt) == 10);
+  while ((rc= mysql_stmt_fetch(stmt)) == 0)
+    DIE_UNLESS(a == ++num_rows);
+  DIE_UNLESS(rc == MYSQL_NO_DATA);
+  DIE_UNLESS(num_rows == 10);
+
+  /* And once more after the stored result */
+  rc= mysql_stmt_execute(stmt);
+  check_execute(stmt, rc);
+  DIE_UNLESS(fetch_cursor_rows(stmt, &a) == 10);
+
+  rc= mysql_stmt_close(stmt);
+  DIE_UNLESS(rc == 0);
+
+  rc= mysql_query(mysql, "drop table t1");
+  myquery(rc);
+}
+
+
 static struct my_tests_st my_tests[]= {
   { "disable_query_logs", disable_query_logs },
   { "test_view_sp_list_fields", test_view_sp_list_fields },
@@ -19713,6 +19807,7 @@ static struct my_tests_st my_tests[]= {
   { "test_ps_sp_out_params", test_ps_sp_out_params },
   { "test_compressed_protocol", test_compressed_protocol },
   { "test_big_packet", test_big_packet },
+  { "test_cursor_last_row_sent", test_cursor_last_row_sent },
   { 0, 0 }
 };
 
@@ -758,11 +758,70 @@ test_strcollsp()
 }
 
 
+/*
+  Check int10_to_str() and longlong10_to_str() against printf()
+  around every power of ten and at the limits of the types.
+*/
+static int
+test_int10_to_str()
+{
+  int failed= 0;
+  ulonglong power= 1;
+  uint i;
+  longlong values[4 * 20 + 4];
+  uint n_values= 0;
+
+  for (i= 0; i < 20; i++, power*= 10)
+  {
+    values[n_values++]= (longlong) power;
+    values[n_values++]= (longlong) (power - 1);
+    values[n_values++]= (longlong) (power + 1);
+    values[n_values++]= - (longlong) power;
+  }
+  values[n_values++]= LONGLONG_MIN;
+  values[n_values++]= LONGLONG_MAX;
+  values[n_values++]= (longlong) ULONGLONG_MAX;
+  values[n_values++]= INT_MIN32;
+
+  for (i= 0; i < n_values; i++)
+  {
+    char buf[32], expected[32], *end;
+    longlong val= values[i];
+
+    my_snprintf(expected, sizeof(expected), "%lld", val);
+    end= longlong10_to_str(val, buf, -10);
+    if (strcmp(buf, expected) || end != buf + strlen(expected))
+    {
+      diag("longlong10_to_str(%s, -10) returned %s", expected, buf);
+      failed++;
+    }
+    my_snprintf(expected, sizeof(expected), "%llu", (ulonglong) val);
+    end= longlong10_to_str(val, buf, 10);
+    if (strcmp(buf, expected) || end != buf + strlen(expected))
+    {
+      diag("longlong10_to_str(%s, 10) returned %s", expected, buf);
+      failed++;
+    }
+    if (val >= INT_MIN32 && val <= INT_MAX32)
+    {
+      my_snprintf(expected, sizeof(expected), "%ld", (long) val);
+      end= int10_to_str((long) val, buf, -10);
+      if (strcmp(buf, expected) || end != buf + strlen(expected))
+      {
+        diag("int10_to_str(%s, -10) returned %s", expected, buf);
+        failed++;
+      }
+    }
+  }
+  return failed;
+}
+
+
 int main()
 {
   size_t i, failed= 0;
   
-  plan(2);
+  plan(3);
   diag("Testing my_like_range_xxx() functions");
   
   for (i= 0; i < array_elements(charset_list); i++)
@@ -780,5 +839,9 @@ int main()
   failed= test_strcollsp();
   ok(failed == 0, "Testing cs->coll->strnncollsp()");
 
+  diag("Testing int10_to_str() and longlong10_to_str()");
+  failed= test_int10_to_str();
+  ok(failed == 0, "Testing int10_to_str() and longlong10_to_str()");
+
   return exit_status();
 }